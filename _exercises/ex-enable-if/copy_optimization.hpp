@@ -0,0 +1,445 @@
+#ifndef COPY_OPTIMIZATION_HPP
+#define COPY_OPTIMIZATION_HPP
+
+#include "segmented_iterator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
+namespace Exercise
+{
+    enum class Implementation {
+        Generic,   // element by element
+        Optimized, // one memmove/memset over contiguous memory
+        Segmented, // one memmove/memset per contiguous block (e.g. std::deque)
+        Streaming, // non-temporal stores - the copied data does not go through the cache
+        Parallel   // page-aligned chunks copied by several threads
+    };
+
+    // segmented iterators - iterators over a sequence of contiguous blocks (shared with ranges/segments.hpp)
+    using helpers::segmented_iterator_traits;
+
+    template <typename It>
+    concept SegmentedIterator = std::random_access_iterator<It>
+        && std::is_lvalue_reference_v<std::iter_reference_t<It>>
+        && segmented_iterator_traits<It>::is_segmented;
+
+    template <typename It>
+    concept BlockIterator = std::contiguous_iterator<It> || SegmentedIterator<It>;
+
+    // items can be copied with memmove
+    template <typename InIt, typename OutIt>
+    concept BitwiseCopyable = std::same_as<std::iter_value_t<InIt>, std::iter_value_t<OutIt>>
+        && std::is_trivially_copyable_v<std::iter_value_t<InIt>>
+        && std::indirectly_writable<OutIt, std::iter_reference_t<InIt>>;
+
+    // items can be filled with memset (or a plain pointer loop)
+    template <typename It, typename T>
+    concept BitwiseFillable = std::is_trivially_copyable_v<std::iter_value_t<It>>
+        && std::convertible_to<const T&, std::iter_value_t<It>>
+        && std::indirectly_writable<It, const std::iter_value_t<It>&>;
+
+    namespace detail
+    {
+        // number of items that can be accessed through a pointer starting at it (at most limit)
+        template <BlockIterator It>
+        std::ptrdiff_t block_size(const It& it, std::ptrdiff_t limit) noexcept
+        {
+            if constexpr (std::contiguous_iterator<It>)
+                return limit;
+            else
+                return std::min<std::ptrdiff_t>(segmented_iterator_traits<It>::block_end(it) - std::addressof(*it), limit);
+        }
+
+        template <typename InIt, typename OutIt>
+        void memmove_blocks(InIt first, InIt last, OutIt dest)
+        {
+            using T = std::iter_value_t<InIt>;
+
+            for (std::ptrdiff_t remaining = last - first; remaining > 0;)
+            {
+                const auto count = block_size(dest, block_size(first, remaining));
+                std::memmove(std::addressof(*dest), std::addressof(*first), static_cast<size_t>(count) * sizeof(T));
+
+                first += count;
+                dest += count;
+                remaining -= count;
+            }
+        }
+
+        template <typename T>
+        bool is_byte_pattern(const T& value) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+                return true;
+            else
+            {
+                unsigned char bytes[sizeof(T)];
+                std::memcpy(bytes, std::addressof(value), sizeof(T));
+                return std::all_of(bytes, bytes + sizeof(T), [&](unsigned char b) { return b == bytes[0]; });
+            }
+        }
+
+        template <typename T>
+        void fill_block(T* first, T* last, const T& value)
+        {
+            if (first == last)
+                return;
+
+            if (is_byte_pattern(value))
+            {
+                unsigned char byte;
+                std::memcpy(&byte, std::addressof(value), 1);
+                std::memset(first, byte, static_cast<size_t>(last - first) * sizeof(T));
+            }
+            else
+            {
+                for (; first != last; ++first) // a plain pointer loop is vectorized
+                    *first = value;
+            }
+        }
+    } // namespace detail
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // copy
+
+    template <std::input_iterator InputIterator, typename OutputIterator>
+    Implementation copy(InputIterator start, InputIterator end, OutputIterator dest)
+    {
+        for (auto it = start; it != end; ++it, ++dest)
+        {
+            *dest = *it;
+        }
+
+        return Implementation::Generic;
+    }
+
+    template <BlockIterator InputIterator, BlockIterator OutputIterator>
+        requires BitwiseCopyable<InputIterator, OutputIterator>
+    Implementation copy(InputIterator start, InputIterator end, OutputIterator dest)
+    {
+        detail::memmove_blocks(start, end, dest);
+
+        return Implementation::Segmented;
+    }
+
+    template <std::contiguous_iterator InputIterator, std::contiguous_iterator OutputIterator>
+        requires BitwiseCopyable<InputIterator, OutputIterator>
+    Implementation copy(InputIterator start, InputIterator end, OutputIterator dest)
+    {
+        if (start != end)
+            std::memmove(std::to_address(dest), std::to_address(start), static_cast<size_t>(end - start) * sizeof(std::iter_value_t<InputIterator>));
+
+        return Implementation::Optimized;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // streaming copy - opt-in mode for copies bigger than the last-level cache
+    //
+    //   Exercise::copy(Exercise::streaming, src.begin(), src.end(), dest.begin());
+    //
+    // A regular copy pulls the whole destination into the cache and evicts the hot working
+    // set of the program. Copies of at least streaming_threshold() bytes between contiguous
+    // ranges use non-temporal stores instead; smaller copies (and other iterators) use
+    // the regular dispatch. The threshold is the size of the last-level cache, read once
+    // at startup - set_streaming_threshold() overrides it.
+
+    struct streaming_t
+    {
+        explicit streaming_t() = default;
+    };
+
+    inline constexpr streaming_t streaming{};
+
+    namespace detail
+    {
+        inline constexpr size_t default_last_level_cache_size = 32 << 20;
+
+        inline size_t last_level_cache_size() noexcept
+        {
+#if defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+            for (int level : {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE})
+            {
+                if (const long size = ::sysconf(level); size > 0)
+                    return static_cast<size_t>(size);
+            }
+#endif
+            return default_last_level_cache_size;
+        }
+
+        inline std::atomic<size_t>& streaming_threshold_storage() noexcept
+        {
+            static std::atomic<size_t> threshold{last_level_cache_size()};
+            return threshold;
+        }
+
+        // like memcpy - src & dest must not overlap
+        inline void stream_copy(void* dest, const void* src, size_t bytes) noexcept
+        {
+#if defined(__SSE2__)
+            auto* out = static_cast<char*>(dest);
+            auto* in = static_cast<const char*>(src);
+
+            // head - until out is 16-byte aligned
+            const size_t head = std::min(static_cast<size_t>(-reinterpret_cast<std::uintptr_t>(out) & 15), bytes);
+            std::memcpy(out, in, head);
+            out += head;
+            in += head;
+            bytes -= head;
+
+            for (; bytes >= 64; bytes -= 64, in += 64, out += 64)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16));
+                const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 48));
+                _mm_stream_si128(reinterpret_cast<__m128i*>(out), a);
+                _mm_stream_si128(reinterpret_cast<__m128i*>(out + 16), b);
+                _mm_stream_si128(reinterpret_cast<__m128i*>(out + 32), c);
+                _mm_stream_si128(reinterpret_cast<__m128i*>(out + 48), d);
+            }
+
+            _mm_sfence(); // non-temporal stores are weakly ordered
+
+            std::memcpy(out, in, bytes);
+#else
+            std::memcpy(dest, src, bytes);
+#endif
+        }
+
+        inline bool overlap(const void* a, const void* b, size_t bytes) noexcept
+        {
+            const auto pa = reinterpret_cast<std::uintptr_t>(a);
+            const auto pb = reinterpret_cast<std::uintptr_t>(b);
+            return pa < pb + bytes && pb < pa + bytes;
+        }
+    } // namespace detail
+
+    inline size_t streaming_threshold() noexcept
+    {
+        return detail::streaming_threshold_storage().load(std::memory_order_relaxed);
+    }
+
+    inline void set_streaming_threshold(size_t bytes) noexcept
+    {
+        detail::streaming_threshold_storage().store(bytes, std::memory_order_relaxed);
+    }
+
+    template <std::input_iterator InputIterator, typename OutputIterator>
+    Implementation copy(streaming_t, InputIterator start, InputIterator end, OutputIterator dest)
+    {
+        if constexpr (std::contiguous_iterator<InputIterator> && std::contiguous_iterator<OutputIterator>
+            && BitwiseCopyable<InputIterator, OutputIterator>)
+        {
+            const size_t bytes = static_cast<size_t>(end - start) * sizeof(std::iter_value_t<InputIterator>);
+            const auto* src = std::to_address(start);
+            auto* target = std::to_address(dest);
+
+            if (bytes != 0 && bytes >= streaming_threshold() && !detail::overlap(src, target, bytes))
+            {
+                detail::stream_copy(target, src, bytes);
+                return Implementation::Streaming;
+            }
+        }
+
+        return Exercise::copy(start, end, dest);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // parallel copy - opt-in mode for copies too big for the bandwidth of one core
+    //
+    //   Exercise::copy(Exercise::parallel, src.begin(), src.end(), dest.begin());
+    //   Exercise::copy(Exercise::parallel_t{4}, src.begin(), src.end(), dest.begin()); // 4 threads
+    //
+    // Copies of at least parallel_copy_threshold() bytes between contiguous ranges are split
+    // into one chunk per thread; chunk boundaries are aligned to pages of the destination,
+    // so no page is written by two threads. Every thread is the first to touch the pages of
+    // its chunk - if the destination was not touched before (e.g. std::make_unique_for_overwrite),
+    // on a NUMA machine its pages are placed on the node of the thread that uses them.
+    // Smaller copies (and other iterators) use the regular dispatch.
+
+    struct parallel_t
+    {
+        size_t thread_count = 0; // 0 - std::thread::hardware_concurrency()
+    };
+
+    inline constexpr parallel_t parallel{};
+
+    namespace detail
+    {
+        inline constexpr size_t default_parallel_copy_threshold = 32 << 20;
+        inline constexpr size_t min_bytes_per_copy_thread = 1 << 20;
+        inline constexpr size_t default_page_size = 4096;
+
+        inline size_t page_size() noexcept
+        {
+#if defined(_SC_PAGESIZE)
+            static const size_t size = [] {
+                const long size = ::sysconf(_SC_PAGESIZE);
+                return size > 0 ? static_cast<size_t>(size) : default_page_size;
+            }();
+            return size;
+#else
+            return default_page_size;
+#endif
+        }
+
+        inline std::atomic<size_t>& parallel_copy_threshold_storage() noexcept
+        {
+            static std::atomic<size_t> threshold{default_parallel_copy_threshold};
+            return threshold;
+        }
+
+        // like memcpy - src & dest must not overlap
+        inline void parallel_copy(void* dest, const void* src, size_t bytes, size_t thread_count)
+        {
+            auto* const out = static_cast<char*>(dest);
+            const auto* const in = static_cast<const char*>(src);
+            const auto page_mask = ~(static_cast<std::uintptr_t>(page_size()) - 1);
+
+            // offset of the first page boundary at or after (out + bytes * part / thread_count)
+            auto boundary = [&](size_t part) -> size_t {
+                if (part == 0)
+                    return 0;
+                if (part == thread_count)
+                    return bytes;
+
+                const auto address = reinterpret_cast<std::uintptr_t>(out) + bytes / thread_count * part;
+                const auto aligned = (address + page_size() - 1) & page_mask;
+                return std::min(static_cast<size_t>(aligned - reinterpret_cast<std::uintptr_t>(out)), bytes);
+            };
+
+            auto copy_chunk = [&](size_t part) {
+                const size_t first = boundary(part);
+                const size_t last = boundary(part + 1);
+                if (first < last)
+                    std::memcpy(out + first, in + first, last - first);
+            };
+
+            std::vector<std::jthread> workers;
+            workers.reserve(thread_count - 1);
+            for (size_t part = 1; part < thread_count; ++part)
+                workers.emplace_back(copy_chunk, part);
+
+            copy_chunk(0); // the calling thread also takes part
+        }
+    } // namespace detail
+
+    inline size_t parallel_copy_threshold() noexcept
+    {
+        return detail::parallel_copy_threshold_storage().load(std::memory_order_relaxed);
+    }
+
+    inline void set_parallel_copy_threshold(size_t bytes) noexcept
+    {
+        detail::parallel_copy_threshold_storage().store(bytes, std::memory_order_relaxed);
+    }
+
+    template <std::input_iterator InputIterator, typename OutputIterator>
+    Implementation copy(parallel_t policy, InputIterator start, InputIterator end, OutputIterator dest)
+    {
+        if constexpr (std::contiguous_iterator<InputIterator> && std::contiguous_iterator<OutputIterator>
+            && BitwiseCopyable<InputIterator, OutputIterator>)
+        {
+            const size_t bytes = static_cast<size_t>(end - start) * sizeof(std::iter_value_t<InputIterator>);
+            const auto* src = std::to_address(start);
+            auto* target = std::to_address(dest);
+
+            const size_t max_threads = policy.thread_count ? policy.thread_count : std::max(std::thread::hardware_concurrency(), 1u);
+            const size_t thread_count = std::min(max_threads, bytes / detail::min_bytes_per_copy_thread);
+
+            if (thread_count > 1 && bytes >= parallel_copy_threshold() && !detail::overlap(src, target, bytes))
+            {
+                detail::parallel_copy(target, src, bytes, thread_count);
+                return Implementation::Parallel;
+            }
+        }
+
+        return Exercise::copy(start, end, dest);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // move - for trivially copyable types a move is a copy
+
+    template <std::input_iterator InputIterator, typename OutputIterator>
+    Implementation move(InputIterator start, InputIterator end, OutputIterator dest)
+    {
+        for (auto it = start; it != end; ++it, ++dest)
+        {
+            *dest = std::move(*it);
+        }
+
+        return Implementation::Generic;
+    }
+
+    template <BlockIterator InputIterator, BlockIterator OutputIterator>
+        requires BitwiseCopyable<InputIterator, OutputIterator>
+    Implementation move(InputIterator start, InputIterator end, OutputIterator dest)
+    {
+        return Exercise::copy(start, end, dest);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // fill - memset when all bytes of the value are equal (e.g. 0 or any char)
+
+    template <std::forward_iterator ForwardIterator, typename T>
+    Implementation fill(ForwardIterator start, ForwardIterator end, const T& value)
+    {
+        for (auto it = start; it != end; ++it)
+        {
+            *it = value;
+        }
+
+        return Implementation::Generic;
+    }
+
+    template <SegmentedIterator ForwardIterator, typename T>
+        requires BitwiseFillable<ForwardIterator, T>
+    Implementation fill(ForwardIterator start, ForwardIterator end, const T& value)
+    {
+        const std::iter_value_t<ForwardIterator> item = value;
+
+        for (std::ptrdiff_t remaining = end - start; remaining > 0;)
+        {
+            const auto count = detail::block_size(start, remaining);
+            auto* const first = std::addressof(*start);
+            detail::fill_block(first, first + count, item);
+
+            start += count;
+            remaining -= count;
+        }
+
+        return Implementation::Segmented;
+    }
+
+    template <std::contiguous_iterator ForwardIterator, typename T>
+        requires BitwiseFillable<ForwardIterator, T>
+    Implementation fill(ForwardIterator start, ForwardIterator end, const T& value)
+    {
+        const std::iter_value_t<ForwardIterator> item = value;
+        detail::fill_block(std::to_address(start), std::to_address(end), item);
+
+        return Implementation::Optimized;
+    }
+} // namespace Exercise
+
+#endif
@@ -1,30 +1,16 @@
+#include "copy_optimization.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <deque>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
-namespace Exercise
-{
-    enum class Implementation {
-        Generic,
-        Optimized
-    };
-
-    template <typename InputIterator, typename OutputIterator>
-    Implementation copy(InputIterator start, InputIterator end, OutputIterator dest)
-    {
-        for (auto it = start; it != end; ++it, ++dest)
-        {
-            *dest = *it;
-        }
-
-        return Implementation::Generic;
-    }
-} // namespace Exercise
-
-// TODO - optimized version with memcpy of copy
-
 TEST_CASE("copy algorithm")
 {
     using Exercise::Implementation;
@@ -48,12 +34,333 @@ TEST_CASE("copy algorithm")
         REQUIRE(std::equal(begin(words), end(words), begin(dest), end(dest)));
     }
 
-    // SECTION("optimized for arrays of POD types")
-    // {
-    //     const int tab1[5] = {1, 2, 3, 4, 5};
-    //     int tab2[5];
+    SECTION("optimized for arrays of POD types")
+    {
+        const int tab1[5] = {1, 2, 3, 4, 5};
+        int tab2[5];
+
+        REQUIRE(Exercise::copy(begin(tab1), end(tab1), begin(tab2)) == Implementation::Optimized);
+        REQUIRE(std::equal(begin(tab1), end(tab1), begin(tab2), end(tab2)));
+    }
+
+    SECTION("optimized for vectors of POD types")
+    {
+        std::vector<double> src = {1.0, 2.0, 3.0};
+        std::vector<double> dest(3);
+
+        REQUIRE(Exercise::copy(src.begin(), src.end(), dest.begin()) == Implementation::Optimized);
+        REQUIRE(src == dest);
+    }
+
+    SECTION("generic when value types differ")
+    {
+        const int src[3] = {1, 2, 3};
+        long dest[3];
+
+        REQUIRE(Exercise::copy(begin(src), end(src), begin(dest)) == Implementation::Generic);
+        REQUIRE(std::equal(begin(src), end(src), begin(dest), end(dest)));
+    }
+
+    SECTION("segmented for deques")
+    {
+        std::deque<int> dq(1000);
+        std::iota(dq.begin(), dq.end(), 0);
+
+        std::vector<int> vec(1000);
+        REQUIRE(Exercise::copy(dq.begin() + 3, dq.end(), vec.begin()) == Implementation::Segmented);
+        REQUIRE(std::equal(dq.begin() + 3, dq.end(), vec.begin()));
+
+        std::deque<int> target(1000);
+        REQUIRE(Exercise::copy(vec.begin(), vec.end(), target.begin()) == Implementation::Segmented);
+        REQUIRE(std::equal(vec.begin(), vec.end(), target.begin()));
+
+        std::deque<int> other(1000);
+        REQUIRE(Exercise::copy(dq.cbegin() + 100, dq.cend(), other.begin() + 7) == Implementation::Segmented);
+        REQUIRE(std::equal(dq.begin() + 100, dq.end(), other.begin() + 7));
+    }
+}
+
+TEST_CASE("move algorithm")
+{
+    using Exercise::Implementation;
+
+    SECTION("generic for strings")
+    {
+        std::vector<std::string> words = {"one", "two", "three"};
+        std::vector<std::string> dest(3);
+
+        REQUIRE(Exercise::move(words.begin(), words.end(), dest.begin()) == Implementation::Generic);
+        REQUIRE(dest == std::vector<std::string>{"one", "two", "three"});
+    }
+
+    SECTION("optimized for overlapping ranges of POD types")
+    {
+        std::vector<int> vec = {1, 2, 3, 4, 5};
+
+        REQUIRE(Exercise::move(vec.begin() + 1, vec.end(), vec.begin()) == Implementation::Optimized);
+        REQUIRE(vec == std::vector{2, 3, 4, 5, 5});
+    }
+}
+
+TEST_CASE("fill algorithm")
+{
+    using Exercise::Implementation;
+
+    SECTION("generic for lists")
+    {
+        std::list<int> lst(5);
+
+        REQUIRE(Exercise::fill(lst.begin(), lst.end(), 7) == Implementation::Generic);
+        REQUIRE(std::ranges::all_of(lst, [](int x) { return x == 7; }));
+    }
+
+    SECTION("optimized for contiguous memory")
+    {
+        std::vector<int> vec(100, 1);
+
+        REQUIRE(Exercise::fill(vec.begin(), vec.end(), 0) == Implementation::Optimized);
+        REQUIRE(std::ranges::all_of(vec, [](int x) { return x == 0; }));
+
+        REQUIRE(Exercise::fill(vec.begin(), vec.end(), 42) == Implementation::Optimized);
+        REQUIRE(std::ranges::all_of(vec, [](int x) { return x == 42; }));
+
+        std::string text(10, ' ');
+        REQUIRE(Exercise::fill(text.begin(), text.end(), '*') == Implementation::Optimized);
+        REQUIRE(text == "**********");
+    }
+
+    SECTION("segmented for deques")
+    {
+        std::deque<short> dq(5000, 1);
+
+        REQUIRE(Exercise::fill(dq.begin() + 1, dq.end() - 1, -1) == Implementation::Segmented);
+        REQUIRE(dq.front() == 1);
+        REQUIRE(dq.back() == 1);
+        REQUIRE(std::all_of(dq.begin() + 1, dq.end() - 1, [](short x) { return x == -1; }));
+    }
+}
+
+TEST_CASE("streaming copy")
+{
+    using Exercise::Implementation;
+
+    const size_t default_threshold = Exercise::streaming_threshold();
+    REQUIRE(default_threshold > 0);
 
-    //     REQUIRE(Exercise::copy(begin(tab1), end(tab1), begin(tab2)) == Implementation::Optimized);
-    //     REQUIRE(std::equal(begin(tab1), end(tab1), begin(tab2), end(tab2)));
-    // }
-}
\ No newline at end of file
+    SECTION("small copies use the regular path")
+    {
+        std::vector<int> src(1000, 1);
+        std::vector<int> dest(1000);
+
+        REQUIRE(Exercise::copy(Exercise::streaming, src.begin(), src.end(), dest.begin()) == Implementation::Optimized);
+        REQUIRE(src == dest);
+    }
+
+    SECTION("copies above the threshold use non-temporal stores")
+    {
+        Exercise::set_streaming_threshold(0);
+
+        std::vector<int> src(10'007);
+        std::iota(src.begin(), src.end(), 0);
+        std::vector<int> dest(src.size() + 1);
+
+        // dest + 1 is not 16-byte aligned - exercises the unaligned head
+        REQUIRE(Exercise::copy(Exercise::streaming, src.begin(), src.end(), dest.begin() + 1) == Implementation::Streaming);
+        REQUIRE(std::equal(src.begin(), src.end(), dest.begin() + 1));
+    }
+
+    SECTION("overlapping ranges & other iterators use the regular dispatch")
+    {
+        Exercise::set_streaming_threshold(0);
+
+        std::vector<int> vec = {1, 2, 3, 4, 5};
+        REQUIRE(Exercise::copy(Exercise::streaming, vec.begin() + 1, vec.end(), vec.begin()) == Implementation::Optimized);
+        REQUIRE(vec == std::vector{2, 3, 4, 5, 5});
+
+        std::list<int> lst = {1, 2, 3};
+        std::vector<int> dest(3);
+        REQUIRE(Exercise::copy(Exercise::streaming, lst.begin(), lst.end(), dest.begin()) == Implementation::Generic);
+    }
+
+    Exercise::set_streaming_threshold(default_threshold);
+}
+
+TEST_CASE("streaming copy - benchmark", "[.benchmark]")
+{
+    const size_t bytes = size_t{64} << 20;
+    const std::vector<int> src(bytes / sizeof(int), 42);
+    std::vector<int> dest(src.size());
+
+    const size_t default_threshold = Exercise::streaming_threshold();
+    Exercise::set_streaming_threshold(0);
+
+    BENCHMARK("memmove - 64 MiB")
+    {
+        return Exercise::copy(src.begin(), src.end(), dest.begin());
+    };
+
+    BENCHMARK("streaming - 64 MiB")
+    {
+        return Exercise::copy(Exercise::streaming, src.begin(), src.end(), dest.begin());
+    };
+
+    // cache pollution - how long does a pass over a hot working set take after a big copy?
+    std::vector<int> hot(2 * 1024 * 1024, 1); // 8 MiB - bigger than L2, lives in the last-level cache
+
+    auto hot_pass_after = [&](auto copy) {
+        using namespace std::chrono;
+
+        const int repeats = 20;
+        nanoseconds elapsed{};
+        long long sum = 0;
+
+        for (int i = 0; i < repeats; ++i)
+        {
+            sum += std::accumulate(hot.begin(), hot.end(), 0LL); // warms up the working set
+            copy();
+
+            const auto start = steady_clock::now();
+            sum += std::accumulate(hot.begin(), hot.end(), 0LL);
+            elapsed += steady_clock::now() - start;
+        }
+
+        REQUIRE(sum == 2LL * repeats * static_cast<long long>(hot.size()));
+        return duration_cast<microseconds>(elapsed / repeats).count();
+    };
+
+    const auto no_copy = hot_pass_after([] {});
+    const auto after_memmove = hot_pass_after([&] { Exercise::copy(src.begin(), src.end(), dest.begin()); });
+    const auto after_streaming = hot_pass_after([&] { Exercise::copy(Exercise::streaming, src.begin(), src.end(), dest.begin()); });
+
+    std::cout << "\nstreaming threshold (last-level cache): " << (default_threshold >> 20) << " MiB\n"
+              << "pass over an 8 MiB hot working set after a 64 MiB copy:\n"
+              << "  no copy:   " << no_copy << " us\n"
+              << "  memmove:   " << after_memmove << " us\n"
+              << "  streaming: " << after_streaming << " us\n";
+
+    Exercise::set_streaming_threshold(default_threshold);
+}
+
+TEST_CASE("parallel copy")
+{
+    using Exercise::Implementation;
+
+    const size_t default_threshold = Exercise::parallel_copy_threshold();
+
+    SECTION("small copies use the regular path")
+    {
+        std::vector<int> src(1000, 1);
+        std::vector<int> dest(1000);
+
+        REQUIRE(Exercise::copy(Exercise::parallel, src.begin(), src.end(), dest.begin()) == Implementation::Optimized);
+        REQUIRE(src == dest);
+    }
+
+    SECTION("copies above the threshold are split between threads")
+    {
+        Exercise::set_parallel_copy_threshold(0);
+
+        std::vector<int> src((4 << 20) / sizeof(int) + 7);
+        std::iota(src.begin(), src.end(), 0);
+
+        // dest + 1 - chunk boundaries are aligned to pages of the destination, not of the source
+        std::vector<int> dest(src.size() + 1);
+
+        REQUIRE(Exercise::copy(Exercise::parallel_t{4}, src.begin(), src.end(), dest.begin() + 1) == Implementation::Parallel);
+        REQUIRE(std::equal(src.begin(), src.end(), dest.begin() + 1));
+        REQUIRE(dest.front() == 0);
+    }
+
+    SECTION("first touch - untouched destination")
+    {
+        Exercise::set_parallel_copy_threshold(0);
+
+        const std::vector<char> src((8 << 20) + 13, 'x');
+        auto dest = std::make_unique_for_overwrite<char[]>(src.size());
+
+        REQUIRE(Exercise::copy(Exercise::parallel_t{3}, src.begin(), src.end(), dest.get()) == Implementation::Parallel);
+        REQUIRE(std::equal(src.begin(), src.end(), dest.get()));
+    }
+
+    SECTION("one thread or overlapping ranges use the regular path")
+    {
+        Exercise::set_parallel_copy_threshold(0);
+
+        std::vector<int> src(1 << 20, 1);
+        std::vector<int> dest(src.size());
+        REQUIRE(Exercise::copy(Exercise::parallel_t{1}, src.begin(), src.end(), dest.begin()) == Implementation::Optimized);
+
+        REQUIRE(Exercise::copy(Exercise::parallel_t{4}, src.begin() + 1, src.end(), src.begin()) == Implementation::Optimized);
+    }
+
+    Exercise::set_parallel_copy_threshold(default_threshold);
+}
+
+TEST_CASE("parallel copy - benchmark", "[.benchmark]")
+{
+    const size_t bytes = size_t{64} << 20;
+    const std::vector<int> src(bytes / sizeof(int), 42);
+    std::vector<int> dest(src.size());
+
+    std::cout << "\nparallel copy - hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    BENCHMARK("memmove - 64 MiB")
+    {
+        return Exercise::copy(src.begin(), src.end(), dest.begin());
+    };
+
+    BENCHMARK("parallel - 64 MiB")
+    {
+        return Exercise::copy(Exercise::parallel, src.begin(), src.end(), dest.begin());
+    };
+
+    // page faults of a fresh destination are taken by all threads
+    BENCHMARK("memmove - 64 MiB - untouched destination")
+    {
+        auto fresh = std::make_unique_for_overwrite<int[]>(src.size());
+        Exercise::copy(src.begin(), src.end(), fresh.get());
+        return fresh[0];
+    };
+
+    BENCHMARK("parallel - 64 MiB - untouched destination")
+    {
+        auto fresh = std::make_unique_for_overwrite<int[]>(src.size());
+        Exercise::copy(Exercise::parallel, src.begin(), src.end(), fresh.get());
+        return fresh[0];
+    };
+}
+
+TEST_CASE("copy algorithm - benchmark", "[.benchmark]")
+{
+    // the biggest size is kept at 64 MiB so the test suite fits in the memory of a CI runner
+    for (size_t bytes : {size_t{16}, size_t{4} << 10, size_t{256} << 10, size_t{16} << 20, size_t{64} << 20})
+    {
+        const size_t count = bytes / sizeof(int);
+        const std::vector<int> src(count, 42);
+        std::vector<int> dest(count);
+        const std::deque<int> dq(src.begin(), src.end());
+
+        const auto suffix = " - " + std::to_string(bytes) + " B";
+
+        // move_iterator hides the contiguity of the source - forces the generic loop
+        BENCHMARK("generic loop" + suffix)
+        {
+            return Exercise::copy(std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()), dest.begin());
+        };
+
+        BENCHMARK("memmove" + suffix)
+        {
+            return Exercise::copy(src.begin(), src.end(), dest.begin());
+        };
+
+        BENCHMARK("std::copy from deque" + suffix)
+        {
+            return std::copy(dq.begin(), dq.end(), dest.begin());
+        };
+
+        BENCHMARK("segmented memmove from deque" + suffix)
+        {
+            return Exercise::copy(dq.begin(), dq.end(), dest.begin());
+        };
+    }
+}
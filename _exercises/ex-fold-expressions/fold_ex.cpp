@@ -1,9 +1,15 @@
+#include "matches.hpp"
+
 #include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
+#include <deque>
 #include <iostream>
+#include <list>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 #include <string_view>
@@ -13,18 +19,131 @@ using namespace std;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-// TODO
+using ModernCpp::matches;
 
 TEST_CASE("matches - returns how many items is stored in a container")
 {
-    // Tip: use std::count() algorithm
+    vector<int> v{1, 2, 3, 4, 5};
+
+    REQUIRE(matches(v, 2, 5) == 2);
+    REQUIRE(matches(v, 100, 200) == 0);
+    REQUIRE(matches("abccdef", 'x', 'y', 'z') == 0);
+    REQUIRE(matches("abccdef", 'a', 'c', 'f') == 4);
+}
+
+TEST_CASE("matches - one pass for any container")
+{
+    SECTION("items equal to several values are counted once")
+    {
+        vector<int> v{1, 2, 2, 3};
+        REQUIRE(matches(v, 2, 2) == 2);
+    }
+
+    SECTION("non-contiguous containers")
+    {
+        list<string> words{"one", "two", "three", "two"};
+        REQUIRE(matches(words, "two"s, "three"s) == 3);
+
+        set<int> numbers{1, 2, 3, 4};
+        REQUIRE(matches(numbers, 1, 4, 7) == 2);
+    }
+
+    SECTION("values of other types than items")
+    {
+        vector<double> v{1.0, 2.5, 3.0};
+        REQUIRE(matches(v, 1, 3) == 2);
+    }
+}
+
+TEST_CASE("matches - vectorized counting")
+{
+    mt19937 rnd{665};
+    uniform_int_distribution<int> byte_distr{0, 255};
+
+    // a size that is not a multiple of the vector width & spans several counter flushes
+    vector<unsigned char> bytes(100'003);
+    generate(bytes.begin(), bytes.end(), [&] { return static_cast<unsigned char>(byte_distr(rnd)); });
+
+    const size_t expected = count_if(bytes.begin(), bytes.end(), [](unsigned char b) { return b == 0 || b == '\n' || b == 0xFF; });
+    REQUIRE(matches(bytes, (unsigned char)0, (unsigned char)'\n', (unsigned char)0xFF) == expected);
+
+    SECTION("every instruction set supported by the CPU gives the same result")
+    {
+        const auto best = ModernCpp::best_matches_isa();
+
+        for (auto instruction_set : {ModernCpp::matches_isa::scalar, ModernCpp::matches_isa::vector, ModernCpp::matches_isa::avx2})
+        {
+            if (instruction_set > best)
+                continue;
+
+            REQUIRE(matches(instruction_set, bytes, (unsigned char)0, (unsigned char)'\n', (unsigned char)0xFF) == expected);
+
+            vector<int> ints(1'027);
+            for (size_t i = 0; i < ints.size(); ++i)
+                ints[i] = static_cast<int>(i % 5);
+            REQUIRE(matches(instruction_set, ints, 1, 4) == 411);
+
+            const vector<char> same(50'000, 'x');
+            REQUIRE(matches(instruction_set, same, 'x', 'y') == same.size());
+        }
+    }
+
+    SECTION("all items match")
+    {
+        const vector<char> same(50'000, 'x');
+        REQUIRE(matches(same, 'x') == same.size());
+        REQUIRE(matches(same, 'x', 'x', 'y') == same.size());
+    }
+
+    SECTION("wider lanes")
+    {
+        vector<short> shorts(1'027);
+        vector<long long> longs(1'027);
+        vector<float> floats(1'027);
+        for (size_t i = 0; i < shorts.size(); ++i)
+        {
+            shorts[i] = static_cast<short>(i % 7);
+            longs[i] = static_cast<long long>(i % 7);
+            floats[i] = static_cast<float>(i % 7);
+        }
+
+        const size_t expected_wide = static_cast<size_t>(count_if(shorts.begin(), shorts.end(), [](short s) { return s == 3 || s == 6; }));
+        REQUIRE(matches(shorts, short{3}, short{6}) == expected_wide);
+        REQUIRE(matches(longs, 3LL, 6LL) == expected_wide);
+        REQUIRE(matches(floats, 3.0f, 6.0f) == expected_wide);
+    }
+
+    SECTION("items without a matching vector lane type use the generic loop")
+    {
+        vector<long double> long_doubles(40, 1.0L);
+        long_doubles[7] = 2.0L;
+        REQUIRE(matches(long_doubles, 1.0L) == 39);
+        REQUIRE(matches(long_doubles, 1.0L, 2.0L) == 40);
+    }
+}
+
+TEST_CASE("matches - benchmark", "[.benchmark]")
+{
+    mt19937 rnd{42};
+    uniform_int_distribution<int> byte_distr{0, 255};
 
-    // vector<int> v{1, 2, 3, 4, 5};
+    vector<char> buffer(64 << 20);
+    generate(buffer.begin(), buffer.end(), [&] { return static_cast<char>(byte_distr(rnd)); });
 
-    // REQUIRE(matches(v, 2, 5) == 2);
-    // REQUIRE(matches(v, 100, 200) == 0);
-    // REQUIRE(matches("abccdef", 'x', 'y', 'z') == 0);
-    // REQUIRE(matches("abccdef", 'a', 'c', 'f') == 4);
+    BENCHMARK("std::count per value - 64 MiB, 3 values")
+    {
+        return count(buffer.begin(), buffer.end(), '\n') + count(buffer.begin(), buffer.end(), '\r') + count(buffer.begin(), buffer.end(), '\0');
+    };
+
+    BENCHMARK("count_if with fold - 64 MiB, 3 values")
+    {
+        return count_if(buffer.begin(), buffer.end(), [](char c) { return c == '\n' || c == '\r' || c == '\0'; });
+    };
+
+    BENCHMARK("matches - 64 MiB, 3 values")
+    {
+        return matches(buffer, '\n', '\r', '\0');
+    };
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,185 @@
+#ifndef MATCHES_HPP
+#define MATCHES_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MODERNCPP_MATCHES_VECTOR_EXTENSIONS
+#if defined(__x86_64__) || defined(__i386__)
+#define MODERNCPP_MATCHES_X86_DISPATCH
+#endif
+#endif
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // matches(container, values...) - number of items equal to any of the values
+    //
+    // One pass over the container - every item is compared with all values in a fold:
+    // ((item == values) || ...). An item equal to several values is counted once.
+    //
+    // For contiguous ranges of 1, 2, 4 or 8-byte arithmetic items searched for values of the same type,
+    // a block of items is compared with a broadcast of every value at once
+    // (GCC/Clang vector extensions) - counting bytes in a large buffer runs at memory speed.
+    // 16-byte vectors are used by default; a 32-byte AVX2 version is compiled with a target
+    // attribute and selected at runtime when the CPU supports it.
+
+    template <typename Rng, typename... Ts>
+    concept VectorCountable = std::ranges::contiguous_range<const Rng&>
+        && std::is_arithmetic_v<std::ranges::range_value_t<Rng>>
+        && !std::same_as<std::ranges::range_value_t<Rng>, bool>
+        && (sizeof(std::ranges::range_value_t<Rng>) == 1 || sizeof(std::ranges::range_value_t<Rng>) == 2
+            || sizeof(std::ranges::range_value_t<Rng>) == 4 || sizeof(std::ranges::range_value_t<Rng>) == 8)
+        && (std::same_as<std::ranges::range_value_t<Rng>, Ts> && ...);
+
+    enum class matches_isa
+    {
+        scalar, // item by item
+        vector, // 16-byte vectors (SSE2 on x86-64)
+        avx2    // 32-byte vectors
+    };
+
+    inline matches_isa detect_matches_isa() noexcept
+    {
+#ifdef MODERNCPP_MATCHES_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return matches_isa::avx2;
+#endif
+#ifdef MODERNCPP_MATCHES_VECTOR_EXTENSIONS
+        return matches_isa::vector;
+#else
+        return matches_isa::scalar;
+#endif
+    }
+
+    // the instruction set used by matches called without an explicit isa
+    inline matches_isa best_matches_isa() noexcept
+    {
+        static const matches_isa detected = detect_matches_isa();
+        return detected;
+    }
+
+    namespace detail
+    {
+        template <typename Rng, typename... Ts>
+        size_t matches_generic(const Rng& container, const Ts&... values)
+        {
+            size_t count = 0;
+            for (const auto& item : container)
+                count += ((item == values) || ...);
+            return count;
+        }
+
+#ifdef MODERNCPP_MATCHES_VECTOR_EXTENSIONS
+        // the counter of a lane is flushed before it can overflow (127 fits in every lane type)
+        inline constexpr size_t matches_blocks_per_flush = 127;
+
+        template <typename T, size_t Bytes>
+        struct matches_lanes
+        {
+            using mask_lane = std::make_signed_t<
+                std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                    std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                        std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>>;
+
+            static constexpr size_t count = Bytes / sizeof(T);
+
+            typedef T vector __attribute__((vector_size(Bytes)));
+            typedef mask_lane mask __attribute__((vector_size(Bytes)));
+        };
+
+        // always inlined into the entry points below - one body serves every vector width
+        template <size_t Bytes, typename T, typename... Ts>
+        [[gnu::always_inline]] inline size_t matches_vector(const T* data, size_t size, const Ts&... values)
+        {
+            using lanes = matches_lanes<T, Bytes>;
+            using vector = typename lanes::vector;
+            using mask = typename lanes::mask;
+
+            size_t count = 0;
+            size_t i = 0;
+
+            while (i + lanes::count <= size)
+            {
+                mask counters{};
+
+                for (size_t block = 0; block < matches_blocks_per_flush && i + lanes::count <= size; ++block, i += lanes::count)
+                {
+                    vector items;
+                    std::memcpy(&items, data + i, sizeof(items));
+
+                    // every value is broadcast to all lanes - the broadcasts are hoisted out of the loop
+                    mask matched{};
+                    ((matched |= (items == (vector{} + values))), ...);
+
+                    counters -= matched; // true lanes are -1
+                }
+
+                for (size_t lane = 0; lane < lanes::count; ++lane)
+                    count += static_cast<size_t>(counters[lane]);
+            }
+
+            return count + matches_generic(std::ranges::subrange(data + i, data + size), values...);
+        }
+
+        template <typename T, typename... Ts>
+        size_t matches_vector16(const T* data, size_t size, const Ts&... values)
+        {
+            return matches_vector<16>(data, size, values...);
+        }
+
+#ifdef MODERNCPP_MATCHES_X86_DISPATCH
+        template <typename T, typename... Ts>
+        [[gnu::target("avx2")]] size_t matches_avx2(const T* data, size_t size, const Ts&... values)
+        {
+            return matches_vector<32>(data, size, values...);
+        }
+#endif
+#endif
+    } // namespace detail
+
+    template <std::ranges::input_range Rng, typename... Ts>
+        requires(sizeof...(Ts) > 0)
+    size_t matches(matches_isa instruction_set, const Rng& container, const Ts&... values)
+    {
+        if constexpr (VectorCountable<Rng, Ts...>)
+        {
+            [[maybe_unused]] const auto* data = std::ranges::data(container);
+            [[maybe_unused]] const size_t size = std::ranges::size(container);
+
+            switch (instruction_set)
+            {
+#ifdef MODERNCPP_MATCHES_X86_DISPATCH
+            case matches_isa::avx2:
+                return detail::matches_avx2(data, size, values...);
+#endif
+#ifdef MODERNCPP_MATCHES_VECTOR_EXTENSIONS
+            case matches_isa::vector:
+                return detail::matches_vector16(data, size, values...);
+#endif
+            default:
+                break;
+            }
+        }
+
+        return detail::matches_generic(container, values...);
+    }
+
+    template <std::ranges::input_range Rng, typename... Ts>
+        requires(sizeof...(Ts) > 0)
+    size_t matches(const Rng& container, const Ts&... values)
+    {
+        return matches(best_matches_isa(), container, values...);
+    }
+} // namespace ModernCpp
+
+#endif
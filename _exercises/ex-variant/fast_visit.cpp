@@ -0,0 +1,193 @@
+#include "fast_visit.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace std::literals;
+
+using ModernCpp::fast_visit;
+using ModernCpp::overloaded;
+
+namespace
+{
+    struct Circle
+    {
+        int radius;
+    };
+
+    struct Rectangle
+    {
+        int width, height;
+    };
+
+    struct Square
+    {
+        int size;
+    };
+
+    using Shape = std::variant<Circle, Rectangle, Square>;
+
+    // events processed in a tight loop
+    struct KeyPressed
+    {
+        int key;
+    };
+
+    struct MouseMoved
+    {
+        int dx, dy;
+    };
+
+    struct Tick
+    { };
+
+    using Event = std::variant<KeyPressed, MouseMoved, Tick>;
+
+    struct ThrowsOnCopy
+    {
+        ThrowsOnCopy() = default;
+
+        ThrowsOnCopy(const ThrowsOnCopy&)
+        {
+            throw std::runtime_error("copy");
+        }
+
+        ThrowsOnCopy& operator=(const ThrowsOnCopy&) = default;
+    };
+} // namespace
+
+TEST_CASE("overloaded")
+{
+    Shape shape = Rectangle{10, 2};
+
+    auto name = std::visit(overloaded{
+                               [](const Circle&) { return "circle"s; },
+                               [](const auto&) { return "polygon"s; }},
+        shape);
+
+    REQUIRE(name == "polygon");
+}
+
+TEST_CASE("fast_visit")
+{
+    const auto area = overloaded{
+        [](const Circle& c) { return 3.14 * c.radius * c.radius; },
+        [](const Rectangle& r) { return 1.0 * r.width * r.height; },
+        [](const Square& s) { return 1.0 * s.size * s.size; }};
+
+    SECTION("same results as std::visit")
+    {
+        std::vector<Shape> shapes = {Circle{1}, Square{10}, Rectangle{10, 1}};
+
+        double total_area = 0.0;
+        for (const auto& shape : shapes)
+        {
+            REQUIRE(fast_visit(area, shape) == std::visit(area, shape));
+            total_area += fast_visit(area, shape);
+        }
+
+        REQUIRE_THAT(total_area, Catch::Matchers::WithinRel(113.14, 0.01));
+    }
+
+    SECTION("references & modification")
+    {
+        Shape shape = Square{2};
+        fast_visit(overloaded{[](Square& s) { s.size *= 2; }, [](auto&) {}}, shape);
+        REQUIRE(std::get<Square>(shape).size == 4);
+
+        std::variant<int, std::string> v = "text"s;
+        std::string& ref = fast_visit(overloaded{[](int&) -> std::string& { throw 1; }, [](std::string& s) -> std::string& { return s; }}, v);
+        REQUIRE(&ref == std::get_if<std::string>(&v));
+    }
+
+    SECTION("rvalues are moved")
+    {
+        std::variant<int, std::unique_ptr<int>> v = std::make_unique<int>(42);
+
+        auto ptr = fast_visit(overloaded{[](int) { return std::unique_ptr<int>{}; }, [](std::unique_ptr<int>&& p) { return std::move(p); }}, std::move(v));
+        REQUIRE(*ptr == 42);
+    }
+
+    SECTION("constexpr")
+    {
+        constexpr std::variant<int, double> v = 2.5;
+        static_assert(fast_visit([](auto x) { return static_cast<int>(x * 2); }, v) == 5);
+    }
+
+    SECTION("valueless variant")
+    {
+        std::variant<int, ThrowsOnCopy> v;
+        ThrowsOnCopy source;
+        REQUIRE_THROWS(v.emplace<ThrowsOnCopy>(source));
+        REQUIRE(v.valueless_by_exception());
+
+        REQUIRE_THROWS_AS(fast_visit([](const auto&) {}, v), std::bad_variant_access);
+    }
+}
+
+TEST_CASE("fast_visit - multiple variants")
+{
+    const auto collides = overloaded{
+        [](const Circle& a, const Circle& b) { return a.radius + b.radius > 10; },
+        [](const Rectangle&, const Circle&) { return true; },
+        [](const auto&, const auto&) { return false; }};
+
+    REQUIRE(fast_visit(collides, Shape{Circle{6}}, Shape{Circle{5}}));
+    REQUIRE_FALSE(fast_visit(collides, Shape{Circle{1}}, Shape{Circle{5}}));
+    REQUIRE(fast_visit(collides, Shape{Rectangle{1, 2}}, Shape{Circle{5}}));
+    REQUIRE_FALSE(fast_visit(collides, Shape{Circle{5}}, Shape{Rectangle{1, 2}}));
+
+    // mixed variant types
+    const auto combine = [](const auto& shape, const auto& event) { return sizeof(shape) * 100 + sizeof(event); };
+    REQUIRE(fast_visit(combine, Shape{Rectangle{1, 1}}, Event{KeyPressed{1}}) == 804);
+    REQUIRE(fast_visit(combine, Shape{Square{1}}, Event{MouseMoved{1, 2}}) == std::visit(combine, Shape{Square{1}}, Event{MouseMoved{1, 2}}));
+}
+
+TEST_CASE("fast_visit - event loop benchmark", "[.benchmark]")
+{
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> distr{0, 2};
+
+    std::vector<Event> events;
+    for (int i = 0; i < 1'000'000; ++i)
+    {
+        switch (distr(rnd))
+        {
+        case 0:
+            events.push_back(KeyPressed{i % 128});
+            break;
+        case 1:
+            events.push_back(MouseMoved{i % 7, -(i % 5)});
+            break;
+        default:
+            events.push_back(Tick{});
+        }
+    }
+
+    const auto handler = overloaded{
+        [](const KeyPressed& e) { return e.key; },
+        [](const MouseMoved& e) { return e.dx + e.dy; },
+        [](const Tick&) { return 1; }};
+
+    BENCHMARK("std::visit")
+    {
+        long long sum = 0;
+        for (const auto& e : events)
+            sum += std::visit(handler, e);
+        return sum;
+    };
+
+    BENCHMARK("fast_visit")
+    {
+        long long sum = 0;
+        for (const auto& e : events)
+            sum += fast_visit(handler, e);
+        return sum;
+    };
+}
@@ -0,0 +1,127 @@
+#ifndef FAST_VISIT_HPP
+#define FAST_VISIT_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // overloaded - builds a visitor from a set of lambdas
+    //
+    //   std::visit(overloaded{[](const Circle& c) { ... }, [](const auto& other) { ... }}, shape);
+    template <typename... Fs>
+    struct overloaded : Fs...
+    {
+        using Fs::operator()...;
+    };
+
+    template <typename... Fs>
+    overloaded(Fs...) -> overloaded<Fs...>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // fast_visit - std::visit implemented as a switch on index()
+    //
+    // For variants with up to fast_visit_max_alternatives alternatives the dispatch is a plain switch -
+    // no table of function pointers - so the visitor is inlined into every case.
+    // Larger variants fall back to std::visit.
+    // Several variants are visited one at a time (a switch per variant nested in the case of
+    // the previous one), so no N1 * N2 * ... table of dispatchers is generated.
+
+    inline constexpr size_t fast_visit_max_alternatives = 16;
+
+    namespace detail
+    {
+        template <size_t I, typename V>
+        constexpr decltype(auto) get_unchecked(V&& v) noexcept
+        {
+            if constexpr (std::is_lvalue_reference_v<V>)
+                return *std::get_if<I>(&v);
+            else
+                return std::move(*std::get_if<I>(&v));
+        }
+
+        template <typename F, typename V, size_t... Is>
+        constexpr bool same_result_for_all_alternatives(std::index_sequence<Is...>)
+        {
+            using R = std::invoke_result_t<F, decltype(get_unchecked<0>(std::declval<V>()))>;
+            return (std::is_same_v<R, std::invoke_result_t<F, decltype(get_unchecked<Is>(std::declval<V>()))>> && ...);
+        }
+
+#define MODERNCPP_FAST_VISIT_CASE(I)                                                         \
+    case I:                                                                                  \
+        if constexpr (I < size)                                                              \
+            return std::invoke(std::forward<F>(f), get_unchecked<I>(std::forward<V>(v)));    \
+        else                                                                                 \
+            std::unreachable();
+
+        template <typename F, typename V>
+        constexpr decltype(auto) visit_one(F&& f, V&& v)
+        {
+            constexpr size_t size = std::variant_size_v<std::remove_cvref_t<V>>;
+
+            if constexpr (size > fast_visit_max_alternatives)
+            {
+                return std::visit(std::forward<F>(f), std::forward<V>(v));
+            }
+            else
+            {
+                static_assert(same_result_for_all_alternatives<F, V>(std::make_index_sequence<size>{}),
+                    "fast_visit requires the visitor to return the same type for all alternatives");
+
+                switch (v.index())
+                {
+                    MODERNCPP_FAST_VISIT_CASE(0)
+                    MODERNCPP_FAST_VISIT_CASE(1)
+                    MODERNCPP_FAST_VISIT_CASE(2)
+                    MODERNCPP_FAST_VISIT_CASE(3)
+                    MODERNCPP_FAST_VISIT_CASE(4)
+                    MODERNCPP_FAST_VISIT_CASE(5)
+                    MODERNCPP_FAST_VISIT_CASE(6)
+                    MODERNCPP_FAST_VISIT_CASE(7)
+                    MODERNCPP_FAST_VISIT_CASE(8)
+                    MODERNCPP_FAST_VISIT_CASE(9)
+                    MODERNCPP_FAST_VISIT_CASE(10)
+                    MODERNCPP_FAST_VISIT_CASE(11)
+                    MODERNCPP_FAST_VISIT_CASE(12)
+                    MODERNCPP_FAST_VISIT_CASE(13)
+                    MODERNCPP_FAST_VISIT_CASE(14)
+                    MODERNCPP_FAST_VISIT_CASE(15)
+                }
+
+                throw std::bad_variant_access{}; // valueless_by_exception
+            }
+        }
+
+#undef MODERNCPP_FAST_VISIT_CASE
+
+        static_assert(fast_visit_max_alternatives == 16, "update the cases of the switch in visit_one");
+    } // namespace detail
+
+    template <typename F, typename V, typename... Vs>
+    constexpr decltype(auto) fast_visit(F&& f, V&& v, Vs&&... vs)
+    {
+        if constexpr (sizeof...(Vs) == 0)
+        {
+            return detail::visit_one(std::forward<F>(f), std::forward<V>(v));
+        }
+        else
+        {
+            // binds the alternative of v & visits the rest of variants
+            return detail::visit_one(
+                [&](auto&& alternative) -> decltype(auto) {
+                    return fast_visit(
+                        [&](auto&&... rest) -> decltype(auto) {
+                            return std::invoke(std::forward<F>(f), std::forward<decltype(alternative)>(alternative), std::forward<decltype(rest)>(rest)...);
+                        },
+                        std::forward<Vs>(vs)...);
+                },
+                std::forward<V>(v));
+        }
+    }
+} // namespace ModernCpp
+
+#endif
@@ -0,0 +1,167 @@
+#include "variant_buckets.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <variant>
+#include <vector>
+
+namespace
+{
+    struct Circle
+    {
+        int radius;
+    };
+
+    struct Rectangle
+    {
+        int width, height;
+    };
+
+    struct Square
+    {
+        int size;
+    };
+
+    struct Area
+    {
+        double operator()(const Circle& c) const
+        {
+            return std::numbers::pi * c.radius * c.radius;
+        }
+
+        double operator()(const Rectangle& r) const
+        {
+            return static_cast<double>(r.width) * r.height;
+        }
+
+        double operator()(const Square& s) const
+        {
+            return static_cast<double>(s.size) * s.size;
+        }
+    };
+
+    using Shape = std::variant<Circle, Rectangle, Square>;
+
+    // classic OO hierarchy for comparison
+    struct ShapeBase
+    {
+        virtual ~ShapeBase() = default;
+        virtual double area() const = 0;
+    };
+
+    template <typename T>
+    struct ShapeModel : ShapeBase
+    {
+        T shape;
+
+        explicit ShapeModel(T s)
+            : shape{s}
+        { }
+
+        double area() const override
+        {
+            return Area{}(shape);
+        }
+    };
+
+    std::vector<Shape> random_shapes(size_t count)
+    {
+        std::mt19937 rnd{42};
+        std::uniform_int_distribution<int> type_distr{0, 2};
+        std::uniform_int_distribution<int> size_distr{1, 100};
+
+        std::vector<Shape> shapes;
+        shapes.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            switch (type_distr(rnd))
+            {
+            case 0:
+                shapes.push_back(Circle{size_distr(rnd)});
+                break;
+            case 1:
+                shapes.push_back(Rectangle{size_distr(rnd), size_distr(rnd)});
+                break;
+            default:
+                shapes.push_back(Square{size_distr(rnd)});
+            }
+        }
+        return shapes;
+    }
+} // namespace
+
+TEST_CASE("variant_buckets")
+{
+    ModernCpp::variant_buckets<Circle, Rectangle, Square> shapes = {Circle{1}, Square{10}, Rectangle{10, 1}, Circle{2}};
+
+    REQUIRE(shapes.size() == 4);
+    REQUIRE(shapes.bucket<Circle>().size() == 2);
+    REQUIRE(shapes.bucket<Circle>()[1].radius == 2);
+    REQUIRE(shapes.bucket<Rectangle>().size() == 1);
+
+    SECTION("total area")
+    {
+        double total_area = shapes.transform_sum(Area{});
+        REQUIRE_THAT(total_area, Catch::Matchers::WithinRel(125.71, 0.01));
+    }
+
+    SECTION("push_back")
+    {
+        shapes.push_back(Square{2});
+        shapes.push_back(Shape{Rectangle{1, 2}});
+
+        REQUIRE(shapes.bucket<Square>().size() == 2);
+        REQUIRE(shapes.bucket<Rectangle>().size() == 2);
+    }
+
+    SECTION("for_each_bucket")
+    {
+        size_t count = 0;
+        shapes.for_each_bucket([&](auto bucket) { count += bucket.size(); });
+        REQUIRE(count == shapes.size());
+    }
+}
+
+TEST_CASE("variant_buckets - total area benchmark", "[.benchmark]")
+{
+    const auto shapes = random_shapes(1'000'000);
+
+    std::vector<std::unique_ptr<ShapeBase>> objects;
+    objects.reserve(shapes.size());
+    for (const auto& shape : shapes)
+        std::visit([&](const auto& s) { objects.push_back(std::make_unique<ShapeModel<std::decay_t<decltype(s)>>>(s)); }, shape);
+
+    const ModernCpp::variant_buckets<Circle, Rectangle, Square> buckets{shapes};
+
+    const double expected = buckets.transform_sum(Area{});
+
+    double visit_total = 0.0;
+    for (const auto& shape : shapes)
+        visit_total += std::visit(Area{}, shape);
+    REQUIRE_THAT(visit_total, Catch::Matchers::WithinRel(expected, 1e-9));
+
+    BENCHMARK("std::visit")
+    {
+        double total = 0.0;
+        for (const auto& shape : shapes)
+            total += std::visit(Area{}, shape);
+        return total;
+    };
+
+    BENCHMARK("virtual area()")
+    {
+        double total = 0.0;
+        for (const auto& shape : objects)
+            total += shape->area();
+        return total;
+    };
+
+    BENCHMARK("variant_buckets::transform_sum")
+    {
+        return buckets.transform_sum(Area{});
+    };
+}
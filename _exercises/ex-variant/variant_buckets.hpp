@@ -0,0 +1,134 @@
+#ifndef VARIANT_BUCKETS_HPP
+#define VARIANT_BUCKETS_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // variant_buckets<Ts...> - polymorphic collection of std::variant<Ts...> values stored by type
+    //
+    // Every alternative has its own contiguous std::vector<T>, so an aggregate over the collection
+    // is one tight loop per type (no per-element dispatch) that the compiler can vectorize.
+    // The order of insertion is not preserved - only the order within a type.
+    template <typename... Ts>
+    class variant_buckets
+    {
+        static_assert(sizeof...(Ts) > 0);
+
+        std::tuple<std::vector<Ts>...> buckets_;
+
+        template <typename T>
+        static constexpr bool is_alternative_v = (std::same_as<T, Ts> || ...);
+
+        static constexpr size_t lanes = 8; // independent partial sums in transform_sum
+
+    public:
+        using value_type = std::variant<Ts...>;
+
+        variant_buckets() = default;
+
+        variant_buckets(std::initializer_list<value_type> items)
+        {
+            for (const auto& item : items)
+                push_back(item);
+        }
+
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, value_type>
+        explicit variant_buckets(R&& items)
+        {
+            for (auto&& item : items)
+                push_back(std::forward<decltype(item)>(item));
+        }
+
+        template <typename T>
+            requires is_alternative_v<std::remove_cvref_t<T>>
+        void push_back(T&& item)
+        {
+            std::get<std::vector<std::remove_cvref_t<T>>>(buckets_).push_back(std::forward<T>(item));
+        }
+
+        void push_back(const value_type& item)
+        {
+            std::visit([this](const auto& alternative) { push_back(alternative); }, item);
+        }
+
+        template <typename T>
+            requires is_alternative_v<T>
+        std::span<const T> bucket() const noexcept
+        {
+            return std::get<std::vector<T>>(buckets_);
+        }
+
+        template <typename T>
+            requires is_alternative_v<T>
+        std::span<T> bucket() noexcept
+        {
+            return std::get<std::vector<T>>(buckets_);
+        }
+
+        size_t size() const noexcept
+        {
+            return (std::get<std::vector<Ts>>(buckets_).size() + ...);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        void clear() noexcept
+        {
+            (std::get<std::vector<Ts>>(buckets_).clear(), ...);
+        }
+
+        // f(std::span<const T>) for every alternative T
+        template <typename F>
+        void for_each_bucket(F&& f) const
+        {
+            (f(bucket<Ts>()), ...);
+        }
+
+        // sum of f(item) over all items - f has an overload for every alternative
+        //
+        // Floating-point sums are vectorized only if the order of additions may change; the loop keeps
+        // 8 independent partial sums, so the result may differ in the last bits from a sequential sum.
+        template <typename F>
+            requires(std::invocable<F&, const Ts&> && ...)
+        auto transform_sum(F f) const
+        {
+            using Result = std::common_type_t<std::invoke_result_t<F&, const Ts&>...>;
+
+            Result total{};
+            for_each_bucket([&](auto items) {
+                std::array<Result, lanes> partial_sums{};
+
+                size_t i = 0;
+                for (; i + lanes <= items.size(); i += lanes)
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        partial_sums[lane] += f(items[i + lane]);
+
+                for (; i < items.size(); ++i)
+                    partial_sums[0] += f(items[i]);
+
+                for (const auto& sum : partial_sums)
+                    total += sum;
+            });
+
+            return total;
+        }
+    };
+} // namespace ModernCpp
+
+#endif
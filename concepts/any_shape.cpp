@@ -0,0 +1,227 @@
+#include "any_shape.hpp"
+#include "render_batch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // remembers where it was when drawn - tells if it lives inside any_shape
+    struct Marker
+    {
+        int size;
+        inline static const void* drawn_at = nullptr;
+
+        void draw() const
+        {
+            drawn_at = this;
+        }
+
+        BoundingBox box() const noexcept
+        {
+            return BoundingBox{size, size};
+        }
+    };
+
+    struct Polygon
+    {
+        std::array<int, 32> xs{};
+        int id;
+        inline static int alive = 0;
+        inline static int draw_count = 0;
+
+        explicit Polygon(int id)
+            : id{id}
+        {
+            ++alive;
+        }
+
+        Polygon(const Polygon& other)
+            : xs{other.xs}
+            , id{other.id}
+        {
+            ++alive;
+        }
+
+        ~Polygon()
+        {
+            --alive;
+        }
+
+        void draw() const
+        {
+            ++draw_count;
+        }
+
+        BoundingBox box() const noexcept
+        {
+            return BoundingBox{id, id};
+        }
+    };
+
+    static_assert(any_shape::is_stored_inline<Marker>);
+    static_assert(!any_shape::is_stored_inline<Polygon>);
+} // namespace
+
+TEST_CASE("any_shape")
+{
+    SECTION("small shapes are stored inline")
+    {
+        any_shape shp = Marker{7};
+        shp.draw();
+
+        const auto* begin = reinterpret_cast<const std::byte*>(&shp);
+        const auto* drawn_at = static_cast<const std::byte*>(Marker::drawn_at);
+        REQUIRE((drawn_at >= begin && drawn_at < begin + sizeof(any_shape)));
+        REQUIRE(shp.box().w == 7);
+    }
+
+    SECTION("Rect & ColorRect")
+    {
+        ColorRect cr{};
+        cr.w = 3;
+        cr.h = 4;
+
+        std::vector<any_shape> shapes;
+        shapes.push_back(Rect{10, 20, {255, 0, 0}});
+        shapes.push_back(cr);
+
+        REQUIRE(shapes[0].box().h == 20);
+        REQUIRE(shapes[1].box().w == 3);
+    }
+
+    SECTION("big shapes are stored on the heap")
+    {
+        {
+            any_shape shp = Polygon{42};
+            REQUIRE(Polygon::alive == 1);
+
+            any_shape copy = shp;
+            REQUIRE(Polygon::alive == 2);
+            REQUIRE(copy.box().w == 42);
+
+            any_shape moved = std::move(shp);
+            REQUIRE(Polygon::alive == 2);
+            REQUIRE(!shp);
+            REQUIRE(moved.box().w == 42);
+
+            copy = moved;
+            REQUIRE(Polygon::alive == 2);
+
+            moved = Marker{1};
+            REQUIRE(Polygon::alive == 1);
+        }
+
+        REQUIRE(Polygon::alive == 0);
+    }
+
+    SECTION("any_shape is a Shape")
+    {
+        std::vector<any_shape> shapes(3, any_shape{Polygon{1}});
+        Polygon::draw_count = 0;
+
+        render_batch(std::span{shapes});
+
+        REQUIRE(Polygon::draw_count == 3);
+    }
+}
+
+namespace
+{
+    struct ShapeBase
+    {
+        virtual ~ShapeBase() = default;
+        virtual void draw() const = 0;
+        virtual BoundingBox box() const noexcept = 0;
+    };
+
+    template <typename T>
+    struct ShapeImpl : ShapeBase
+    {
+        T shape;
+
+        explicit ShapeImpl(T shp)
+            : shape{shp}
+        { }
+
+        void draw() const override
+        {
+            shape.draw();
+        }
+
+        BoundingBox box() const noexcept override
+        {
+            return shape.box();
+        }
+    };
+
+    BoundingBox box_of(const any_shape& shp) noexcept
+    {
+        return shp.box();
+    }
+
+    BoundingBox box_of(const std::unique_ptr<ShapeBase>& shp) noexcept
+    {
+        return shp->box();
+    }
+
+    long long total_area(const auto& shapes)
+    {
+        return std::accumulate(shapes.begin(), shapes.end(), 0LL, [](long long sum, const auto& shp) {
+            const auto box = box_of(shp);
+            return sum + box.w * box.h;
+        });
+    }
+} // namespace
+
+TEST_CASE("any_shape - benchmark", "[.benchmark]")
+{
+    const size_t count = 1'000'000;
+
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> size_distr{1, 100};
+
+    std::vector<any_shape> shapes;
+    std::vector<std::unique_ptr<ShapeBase>> objects;
+    shapes.reserve(count);
+    objects.reserve(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Rect r{size_distr(rnd), size_distr(rnd), {}};
+        if (i % 2 == 0)
+        {
+            shapes.push_back(r);
+            objects.push_back(std::make_unique<ShapeImpl<Rect>>(r));
+        }
+        else
+        {
+            ColorRect cr{};
+            cr.w = r.w;
+            cr.h = r.h;
+            shapes.push_back(cr);
+            objects.push_back(std::make_unique<ShapeImpl<ColorRect>>(cr));
+        }
+    }
+
+    // heap objects of a long running program are rarely allocated in the order of use
+    std::ranges::shuffle(objects, rnd);
+
+    REQUIRE(total_area(shapes) == total_area(objects));
+
+    BENCHMARK("vector<unique_ptr<ShapeBase>>")
+    {
+        return total_area(objects);
+    };
+
+    BENCHMARK("vector<any_shape>")
+    {
+        return total_area(shapes);
+    };
+}
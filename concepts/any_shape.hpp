@@ -0,0 +1,228 @@
+#ifndef ANY_SHAPE_HPP
+#define ANY_SHAPE_HPP
+
+#include "shapes.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////
+// any_shape - type erasure for any type satisfying Shape
+//
+// Small shapes (Rect, ColorRect) are stored in an inline buffer - no heap allocation.
+// Bigger shapes (or shapes with a throwing move) are stored on the heap.
+// Pointers to box() & draw() are stored in the object itself, so a call costs one indirect
+// jump - no load of a vtable pointer first. Copy/move/destroy are rare and share one
+// static table per type.
+//
+// A vector<any_shape> keeps the shapes contiguous, unlike vector<unique_ptr<Base>>.
+
+class any_shape
+{
+public:
+    static constexpr size_t buffer_size = 16;
+    static constexpr size_t buffer_alignment = alignof(void*);
+
+    template <typename T>
+    static constexpr bool is_stored_inline = sizeof(T) <= buffer_size
+        && alignof(T) <= buffer_alignment
+        && std::is_nothrow_move_constructible_v<T>;
+
+private:
+    struct lifetime_ops
+    {
+        void (*copy)(const void* src, void* dest);
+        void (*move)(void* src, void* dest) noexcept; // moves src to dest & destroys src
+        void (*destroy)(void* buffer) noexcept;
+    };
+
+    template <typename T>
+    struct inline_model
+    {
+        static const T& get(const void* buffer) noexcept
+        {
+            return *std::launder(static_cast<const T*>(buffer));
+        }
+
+        static T& get(void* buffer) noexcept
+        {
+            return *std::launder(static_cast<T*>(buffer));
+        }
+
+        template <typename U>
+        static void create(void* buffer, U&& shape)
+        {
+            ::new (buffer) T(std::forward<U>(shape));
+        }
+
+        static void copy(const void* src, void* dest)
+        {
+            ::new (dest) T(get(src));
+        }
+
+        static void move(void* src, void* dest) noexcept
+        {
+            ::new (dest) T(std::move(get(src)));
+            get(src).~T();
+        }
+
+        static void destroy(void* buffer) noexcept
+        {
+            get(buffer).~T();
+        }
+    };
+
+    template <typename T>
+    struct heap_model
+    {
+        static const T& get(const void* buffer) noexcept
+        {
+            return **static_cast<T* const*>(buffer);
+        }
+
+        static T& get(void* buffer) noexcept
+        {
+            return **static_cast<T**>(buffer);
+        }
+
+        template <typename U>
+        static void create(void* buffer, U&& shape)
+        {
+            ::new (buffer) T*(new T(std::forward<U>(shape)));
+        }
+
+        static void copy(const void* src, void* dest)
+        {
+            ::new (dest) T*(new T(get(src)));
+        }
+
+        static void move(void* src, void* dest) noexcept
+        {
+            ::new (dest) T*(*static_cast<T**>(src)); // steals the pointer
+        }
+
+        static void destroy(void* buffer) noexcept
+        {
+            delete *static_cast<T**>(buffer);
+        }
+    };
+
+    template <typename T>
+    using model = std::conditional_t<is_stored_inline<T>, inline_model<T>, heap_model<T>>;
+
+    template <typename T>
+    static constexpr lifetime_ops lifetime_ops_for{&model<T>::copy, &model<T>::move, &model<T>::destroy};
+
+    alignas(buffer_alignment) std::byte buffer_[buffer_size];
+    BoundingBox (*box_)(const void*) noexcept = nullptr;
+    void (*draw_)(const void*) = nullptr;
+    const lifetime_ops* ops_ = nullptr;
+
+    void reset() noexcept
+    {
+        if (ops_)
+            ops_->destroy(buffer_);
+
+        box_ = nullptr;
+        draw_ = nullptr;
+        ops_ = nullptr;
+    }
+
+    void steal(any_shape& other) noexcept
+    {
+        if (other.ops_)
+        {
+            other.ops_->move(other.buffer_, buffer_);
+            box_ = std::exchange(other.box_, nullptr);
+            draw_ = std::exchange(other.draw_, nullptr);
+            ops_ = std::exchange(other.ops_, nullptr);
+        }
+    }
+
+public:
+    any_shape() noexcept = default;
+
+    template <typename T>
+        requires(!std::same_as<std::remove_cvref_t<T>, any_shape>) && Shape<std::remove_cvref_t<T>>
+    any_shape(T&& shape)
+    {
+        using ShapeT = std::remove_cvref_t<T>;
+        static_assert(sizeof(ShapeT*) <= buffer_size);
+
+        model<ShapeT>::create(buffer_, std::forward<T>(shape));
+
+        box_ = [](const void* buffer) noexcept { return model<ShapeT>::get(buffer).box(); };
+        draw_ = [](const void* buffer) { model<ShapeT>::get(buffer).draw(); };
+        ops_ = &lifetime_ops_for<ShapeT>;
+    }
+
+    any_shape(const any_shape& other)
+        : box_{other.box_}
+        , draw_{other.draw_}
+        , ops_{other.ops_}
+    {
+        if (ops_)
+            ops_->copy(other.buffer_, buffer_);
+    }
+
+    any_shape(any_shape&& other) noexcept
+    {
+        steal(other);
+    }
+
+    any_shape& operator=(const any_shape& other)
+    {
+        if (this != &other)
+        {
+            any_shape temp(other);
+            reset();
+            steal(temp);
+        }
+
+        return *this;
+    }
+
+    any_shape& operator=(any_shape&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    ~any_shape()
+    {
+        reset();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return ops_ != nullptr;
+    }
+
+    BoundingBox box() const noexcept
+    {
+        assert(box_ != nullptr);
+        return box_(buffer_);
+    }
+
+    void draw() const
+    {
+        assert(draw_ != nullptr);
+        draw_(buffer_);
+    }
+};
+
+static_assert(Shape<any_shape>);
+static_assert(any_shape::is_stored_inline<Rect>);
+static_assert(any_shape::is_stored_inline<ColorRect>);
+
+#endif
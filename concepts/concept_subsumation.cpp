@@ -1,3 +1,5 @@
+#include "shapes.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <concepts>
 #include <deque>
@@ -8,62 +10,6 @@
 
 using namespace std::literals;
 
-struct BoundingBox
-{
-    int w, h;
-};
-
-struct Color
-{
-    uint8_t r, g, b;
-};
-
-struct Rect
-{
-    int w, h;
-    Color color;
-
-    void draw() const
-    {
-        std::cout << "Rect::draw()\n";
-    }
-
-    BoundingBox box() const noexcept
-    {
-        return BoundingBox{w, h};
-    }
-};
-
-struct ColorRect : Rect
-{
-    Color color;
-
-    Color get_color() const noexcept
-    {
-        return color;
-    }
-
-    void set_color(Color new_color)
-    {
-        color = new_color;
-    }
-};
-
-// clang-format off
-template <typename T>
-concept Shape = requires(const T& obj)
-{
-    { obj.box() } noexcept -> std::same_as<BoundingBox>;
-    obj.draw();
-};
-// clang-format on
-
-template <typename T>
-concept ShapeWithColor = Shape<T> && requires(T obj, Color color) {
-    { obj.get_color() } -> std::same_as<Color>;
-    obj.set_color(color);
-};
-
 static_assert(Shape<Rect>);
 static_assert(Shape<ColorRect>);
 
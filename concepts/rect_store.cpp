@@ -0,0 +1,155 @@
+#include "rect_store.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    std::vector<Rect> random_rects(size_t count)
+    {
+        std::mt19937 rnd{42};
+        std::uniform_int_distribution<int> size_distr{1, 1000};
+
+        std::vector<Rect> rects;
+        rects.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            rects.push_back(Rect{size_distr(rnd), size_distr(rnd), Color{static_cast<uint8_t>(i), 0, 0}});
+        return rects;
+    }
+
+    RectStore make_store(const std::vector<Rect>& rects)
+    {
+        RectStore store;
+        store.reserve(rects.size());
+        for (const auto& r : rects)
+            store.push_back(r);
+        return store;
+    }
+
+    // the scalar kernels & every vector kernel the CPU can run
+    std::vector<RectStore::isa> supported_isas()
+    {
+        std::vector isas{RectStore::isa::scalar};
+        if (RectStore::best_isa() == RectStore::isa::avx2)
+            isas.push_back(RectStore::isa::avx2);
+        return isas;
+    }
+} // namespace
+
+TEST_CASE("RectStore - memory report")
+{
+    const size_t count = 1'000'000;
+    const RectStore store = make_store(random_rects(count));
+
+    std::cout << "\nbytes per rect:\n"
+              << "  Rect (AoS):       " << sizeof(Rect) << "\n"
+              << "  ColorRect (AoS):  " << sizeof(ColorRect) << "\n"
+              << "  RectStore (SoA):  " << RectStore::bytes_per_rect
+              << " (" << static_cast<double>(store.memory_footprint()) / count << " incl. capacity)\n";
+
+    REQUIRE(RectStore::bytes_per_rect < sizeof(Rect));
+    REQUIRE(RectStore::bytes_per_rect < sizeof(ColorRect));
+}
+
+TEST_CASE("RectStore - box queries")
+{
+    // 19 rects - full SIMD blocks & a scalar tail
+    const auto rects = random_rects(19);
+    const RectStore store = make_store(rects);
+
+    REQUIRE(store.size() == 19);
+    REQUIRE(store.box(5).w == rects[5].w);
+    REQUIRE(store.color(7).r == 7);
+
+    SECTION("areas")
+    {
+        for (auto instruction_set : supported_isas())
+        {
+            std::vector<int> areas(store.size());
+            store.areas(instruction_set, areas);
+
+            for (size_t i = 0; i < rects.size(); ++i)
+                REQUIRE(areas[i] == rects[i].w * rects[i].h);
+
+            REQUIRE_THROWS_AS(store.areas(instruction_set, std::span{areas}.first(3)), std::length_error);
+        }
+    }
+
+    SECTION("union")
+    {
+        BoundingBox expected{0, 0};
+        for (const auto& r : rects)
+        {
+            expected.w = std::max(expected.w, r.w);
+            expected.h = std::max(expected.h, r.h);
+        }
+
+        for (auto instruction_set : supported_isas())
+        {
+            auto united = store.bounding_union(instruction_set);
+            REQUIRE(united.w == expected.w);
+            REQUIRE(united.h == expected.h);
+        }
+    }
+
+    SECTION("overlap")
+    {
+        const BoundingBox query{500, 300};
+
+        for (auto instruction_set : supported_isas())
+        {
+            std::vector<int> overlaps(store.size());
+            store.overlap_areas(instruction_set, query, overlaps);
+
+            size_t expected_fitting = 0;
+            for (size_t i = 0; i < rects.size(); ++i)
+            {
+                REQUIRE(overlaps[i] == std::min(rects[i].w, query.w) * std::min(rects[i].h, query.h));
+                expected_fitting += rects[i].w <= query.w && rects[i].h <= query.h;
+            }
+
+            REQUIRE(store.count_fitting(instruction_set, query) == expected_fitting);
+        }
+    }
+
+    SECTION("default queries use the best kernels")
+    {
+        std::vector<int> areas(store.size());
+        store.areas(areas);
+        REQUIRE(areas[3] == rects[3].w * rects[3].h);
+        REQUIRE(store.count_fitting(BoundingBox{1000, 1000}) == store.size());
+        REQUIRE(store.bounding_union(RectStore::isa::scalar).w == store.bounding_union().w);
+    }
+
+    SECTION("ColorRect keeps only its own color")
+    {
+        ColorRect cr{};
+        cr.w = 1;
+        cr.h = 2;
+        cr.set_color(Color{1, 2, 3});
+
+        RectStore colored;
+        colored.push_back(cr);
+        REQUIRE(colored.color(0).b == 3);
+    }
+}
+
+TEST_CASE("RectStore - benchmark", "[.benchmark]")
+{
+    const auto rects = random_rects(1'000'000);
+    const RectStore store = make_store(rects);
+    const BoundingBox query{500, 300};
+
+    BENCHMARK("count fitting - vector<Rect>")
+    {
+        return std::ranges::count_if(rects, [&](const Rect& r) { return r.w <= query.w && r.h <= query.h; });
+    };
+
+    BENCHMARK("count fitting - RectStore")
+    {
+        return store.count_fitting(query);
+    };
+}
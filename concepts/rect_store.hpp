@@ -0,0 +1,317 @@
+#ifndef RECT_STORE_HPP
+#define RECT_STORE_HPP
+
+#include "shapes.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MODERNCPP_RECT_STORE_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// RectStore - rects stored as columns (structure of arrays)
+//
+// sizeof(Rect) is 12 bytes (w, h, 3-byte Color + 1 byte of padding) and sizeof(ColorRect) is 16
+// (the shadowing ColorRect::color duplicates Rect::color). The store keeps one color per rect and
+// no padding - 11 bytes per rect - and box queries run over contiguous int columns, 8 rects
+// per step with AVX2. The AVX2 kernels are compiled with a target attribute and selected at
+// runtime when the CPU supports them.
+//
+// Boxes have no position - every box is anchored at the origin, so two boxes overlap on
+// min(w1, w2) x min(h1, h2).
+
+namespace rect_store_detail
+{
+    // scalar kernels process [first, size) - they also finish the tails of the vector kernels
+
+    inline void areas_scalar(const int* widths, const int* heights, int* out, size_t first, size_t size) noexcept
+    {
+        for (size_t i = first; i < size; ++i)
+            out[i] = widths[i] * heights[i];
+    }
+
+    inline BoundingBox bounding_union_scalar(const int* widths, const int* heights, BoundingBox result, size_t first, size_t size) noexcept
+    {
+        for (size_t i = first; i < size; ++i)
+        {
+            result.w = std::max(result.w, widths[i]);
+            result.h = std::max(result.h, heights[i]);
+        }
+        return result;
+    }
+
+    inline void overlap_areas_scalar(const int* widths, const int* heights, BoundingBox query, int* out, size_t first, size_t size) noexcept
+    {
+        for (size_t i = first; i < size; ++i)
+            out[i] = std::min(query.w, widths[i]) * std::min(query.h, heights[i]);
+    }
+
+    inline size_t count_fitting_scalar(const int* widths, const int* heights, BoundingBox query, size_t first, size_t size) noexcept
+    {
+        size_t count = 0;
+        for (size_t i = first; i < size; ++i)
+            count += (widths[i] <= query.w && heights[i] <= query.h);
+        return count;
+    }
+
+#ifdef MODERNCPP_RECT_STORE_X86_DISPATCH
+    [[gnu::target("avx2")]] inline void areas_avx2(const int* widths, const int* heights, int* out, size_t size) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(widths + i));
+            const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(heights + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_mullo_epi32(w, h));
+        }
+
+        areas_scalar(widths, heights, out, i, size);
+    }
+
+    [[gnu::target("avx2")]] inline BoundingBox bounding_union_avx2(const int* widths, const int* heights, size_t size) noexcept
+    {
+        BoundingBox result{0, 0};
+
+        size_t i = 0;
+        if (size >= 8)
+        {
+            __m256i max_w = _mm256_setzero_si256();
+            __m256i max_h = _mm256_setzero_si256();
+
+            for (; i + 8 <= size; i += 8)
+            {
+                max_w = _mm256_max_epi32(max_w, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(widths + i)));
+                max_h = _mm256_max_epi32(max_h, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(heights + i)));
+            }
+
+            alignas(32) int lanes_w[8];
+            alignas(32) int lanes_h[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes_w), max_w);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes_h), max_h);
+
+            result.w = *std::max_element(std::begin(lanes_w), std::end(lanes_w));
+            result.h = *std::max_element(std::begin(lanes_h), std::end(lanes_h));
+        }
+
+        return bounding_union_scalar(widths, heights, result, i, size);
+    }
+
+    [[gnu::target("avx2")]] inline void overlap_areas_avx2(const int* widths, const int* heights, BoundingBox query, int* out, size_t size) noexcept
+    {
+        const __m256i qw = _mm256_set1_epi32(query.w);
+        const __m256i qh = _mm256_set1_epi32(query.h);
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            const __m256i w = _mm256_min_epi32(qw, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(widths + i)));
+            const __m256i h = _mm256_min_epi32(qh, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(heights + i)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_mullo_epi32(w, h));
+        }
+
+        overlap_areas_scalar(widths, heights, query, out, i, size);
+    }
+
+    [[gnu::target("avx2")]] inline size_t count_fitting_avx2(const int* widths, const int* heights, BoundingBox query, size_t size) noexcept
+    {
+        const __m256i qw = _mm256_set1_epi32(query.w);
+        const __m256i qh = _mm256_set1_epi32(query.h);
+
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(widths + i));
+            const __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(heights + i));
+            const __m256i too_big = _mm256_or_si256(_mm256_cmpgt_epi32(w, qw), _mm256_cmpgt_epi32(h, qh));
+            count += 8 - static_cast<size_t>(std::popcount(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(too_big)))));
+        }
+
+        return count + count_fitting_scalar(widths, heights, query, i, size);
+    }
+#endif
+} // namespace rect_store_detail
+
+class RectStore
+{
+    std::vector<int> widths_;
+    std::vector<int> heights_;
+    std::vector<Color> colors_;
+
+    void check_output(std::span<int> out) const
+    {
+        if (out.size() < size())
+            throw std::length_error("RectStore - output span is too small");
+    }
+
+public:
+    static constexpr size_t bytes_per_rect = 2 * sizeof(int) + sizeof(Color);
+
+    RectStore() = default;
+
+    void reserve(size_t count)
+    {
+        widths_.reserve(count);
+        heights_.reserve(count);
+        colors_.reserve(count);
+    }
+
+    void push_back(const Rect& rect)
+    {
+        widths_.push_back(rect.w);
+        heights_.push_back(rect.h);
+        colors_.push_back(rect.color);
+    }
+
+    void push_back(const ColorRect& rect)
+    {
+        widths_.push_back(rect.w);
+        heights_.push_back(rect.h);
+        colors_.push_back(rect.get_color());
+    }
+
+    size_t size() const noexcept
+    {
+        return widths_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return widths_.empty();
+    }
+
+    BoundingBox box(size_t index) const noexcept
+    {
+        return BoundingBox{widths_[index], heights_[index]};
+    }
+
+    Color color(size_t index) const noexcept
+    {
+        return colors_[index];
+    }
+
+    std::span<const int> widths() const noexcept
+    {
+        return widths_;
+    }
+
+    std::span<const int> heights() const noexcept
+    {
+        return heights_;
+    }
+
+    std::span<const Color> colors() const noexcept
+    {
+        return colors_;
+    }
+
+    // bytes allocated by the store
+    size_t memory_footprint() const noexcept
+    {
+        return widths_.capacity() * sizeof(int) + heights_.capacity() * sizeof(int) + colors_.capacity() * sizeof(Color);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // box queries - the versions without an isa use the best one supported by the CPU
+
+    enum class isa
+    {
+        scalar,
+        avx2
+    };
+
+    static isa detect_isa() noexcept
+    {
+#ifdef MODERNCPP_RECT_STORE_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return isa::avx2;
+#endif
+        return isa::scalar;
+    }
+
+    static isa best_isa() noexcept
+    {
+        static const isa detected = detect_isa();
+        return detected;
+    }
+
+    // out[i] = w * h
+    void areas(isa instruction_set, std::span<int> out) const
+    {
+        check_output(out);
+
+#ifdef MODERNCPP_RECT_STORE_X86_DISPATCH
+        if (instruction_set == isa::avx2)
+            return rect_store_detail::areas_avx2(widths_.data(), heights_.data(), out.data(), size());
+#endif
+        (void)instruction_set;
+        rect_store_detail::areas_scalar(widths_.data(), heights_.data(), out.data(), 0, size());
+    }
+
+    void areas(std::span<int> out) const
+    {
+        areas(best_isa(), out);
+    }
+
+    // the smallest box containing all boxes
+    BoundingBox bounding_union(isa instruction_set) const noexcept
+    {
+#ifdef MODERNCPP_RECT_STORE_X86_DISPATCH
+        if (instruction_set == isa::avx2)
+            return rect_store_detail::bounding_union_avx2(widths_.data(), heights_.data(), size());
+#endif
+        (void)instruction_set;
+        return rect_store_detail::bounding_union_scalar(widths_.data(), heights_.data(), BoundingBox{0, 0}, 0, size());
+    }
+
+    BoundingBox bounding_union() const noexcept
+    {
+        return bounding_union(best_isa());
+    }
+
+    // out[i] = area of the overlap of box(i) & query
+    void overlap_areas(isa instruction_set, BoundingBox query, std::span<int> out) const
+    {
+        check_output(out);
+
+#ifdef MODERNCPP_RECT_STORE_X86_DISPATCH
+        if (instruction_set == isa::avx2)
+            return rect_store_detail::overlap_areas_avx2(widths_.data(), heights_.data(), query, out.data(), size());
+#endif
+        (void)instruction_set;
+        rect_store_detail::overlap_areas_scalar(widths_.data(), heights_.data(), query, out.data(), 0, size());
+    }
+
+    void overlap_areas(BoundingBox query, std::span<int> out) const
+    {
+        overlap_areas(best_isa(), query, out);
+    }
+
+    // number of boxes that fit inside query
+    size_t count_fitting(isa instruction_set, BoundingBox query) const noexcept
+    {
+#ifdef MODERNCPP_RECT_STORE_X86_DISPATCH
+        if (instruction_set == isa::avx2)
+            return rect_store_detail::count_fitting_avx2(widths_.data(), heights_.data(), query, size());
+#endif
+        (void)instruction_set;
+        return rect_store_detail::count_fitting_scalar(widths_.data(), heights_.data(), query, 0, size());
+    }
+
+    size_t count_fitting(BoundingBox query) const noexcept
+    {
+        return count_fitting(best_isa(), query);
+    }
+};
+
+#endif
@@ -0,0 +1,122 @@
+#include "render_batch.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <streambuf>
+#include <vector>
+
+namespace
+{
+    struct Circle
+    {
+        int r;
+        inline static int draw_count = 0;
+
+        void draw() const
+        {
+            ++draw_count;
+        }
+
+        BoundingBox box() const noexcept
+        {
+            return BoundingBox{2 * r, 2 * r};
+        }
+    };
+
+    static_assert(Shape<Circle>);
+    static_assert(!BufferedDrawable<Circle>);
+
+    // discards everything - measures the cost of the calls, not of the terminal
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int_type overflow(int_type c) override
+        {
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(const char*, std::streamsize count) override
+        {
+            return count;
+        }
+    };
+
+    class CoutRedirect
+    {
+        std::streambuf* original_;
+
+    public:
+        explicit CoutRedirect(std::streambuf* target)
+            : original_{std::cout.rdbuf(target)}
+        { }
+
+        CoutRedirect(const CoutRedirect&) = delete;
+        CoutRedirect& operator=(const CoutRedirect&) = delete;
+
+        ~CoutRedirect()
+        {
+            std::cout.rdbuf(original_);
+        }
+    };
+} // namespace
+
+TEST_CASE("render_batch")
+{
+    SECTION("Shape - one write with all the output")
+    {
+        std::vector<Rect> rects(3, Rect{10, 20, {255, 0, 0}});
+        std::ostringstream out;
+
+        render_batch(std::span{rects}, out);
+
+        REQUIRE(out.str() == "Rect::draw()\nRect::draw()\nRect::draw()\n");
+        REQUIRE(std::ranges::all_of(rects, [](const Rect& r) { return r.color.r == 255; }));
+    }
+
+    SECTION("ShapeWithColor - colors are reset before drawing")
+    {
+        std::vector<ColorRect> rects(5);
+        for (auto& cr : rects)
+            cr.set_color(Color{0, 255, 0});
+
+        std::ostringstream out;
+        render_batch(std::span{rects}, out);
+
+        REQUIRE(std::ranges::all_of(rects, [](const ColorRect& cr) { return cr.get_color().g == 0; }));
+        REQUIRE(out.str().size() == 5 * std::string_view{"Rect::draw()\n"}.size());
+    }
+
+    SECTION("shapes without buffered draw are drawn one by one")
+    {
+        std::vector<Circle> circles(4, Circle{1});
+        Circle::draw_count = 0;
+
+        render_batch(std::span{circles});
+
+        REQUIRE(Circle::draw_count == 4);
+    }
+}
+
+TEST_CASE("render_batch - benchmark", "[.benchmark]")
+{
+    std::vector<Rect> rects(100'000, Rect{10, 20, {255, 0, 0}});
+
+    NullBuffer null_buffer;
+    std::ostream null_out{&null_buffer};
+
+    BENCHMARK("draw() one by one")
+    {
+        CoutRedirect redirect{&null_buffer};
+        for (const auto& r : rects)
+            r.draw();
+        return rects.size();
+    };
+
+    BENCHMARK("render_batch")
+    {
+        render_batch(std::span{rects}, null_out);
+        return rects.size();
+    };
+}
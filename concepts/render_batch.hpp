@@ -0,0 +1,57 @@
+#ifndef RENDER_BATCH_HPP
+#define RENDER_BATCH_HPP
+
+#include "shapes.hpp"
+
+#include <iostream>
+#include <span>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// render_batch - renders a span of shapes with one write to the output stream
+//
+// Overloads are selected with the same subsumption rules as render(T&):
+// for ShapeWithColor types colors are set in a separate pass (a tight loop without I/O)
+// before anything is drawn.
+
+template <typename T>
+concept BufferedDrawable = requires(const T& obj, std::string& buffer) {
+    obj.draw(buffer);
+};
+
+namespace render_batch_detail
+{
+    template <Shape T>
+    void draw_all(std::span<T> shapes, std::ostream& out)
+    {
+        if constexpr (BufferedDrawable<T>)
+        {
+            std::string buffer;
+            for (const T& shp : shapes)
+                shp.draw(buffer);
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+        else
+        {
+            for (const T& shp : shapes)
+                shp.draw(); // draws to its own output
+        }
+    }
+} // namespace render_batch_detail
+
+template <Shape T>
+void render_batch(std::span<T> shapes, std::ostream& out = std::cout)
+{
+    render_batch_detail::draw_all(shapes, out);
+}
+
+template <ShapeWithColor T>
+void render_batch(std::span<T> shapes, std::ostream& out = std::cout)
+{
+    for (T& shp : shapes)
+        shp.set_color(Color{0, 0, 0});
+
+    render_batch_detail::draw_all(shapes, out);
+}
+
+#endif
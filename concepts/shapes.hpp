@@ -0,0 +1,73 @@
+#ifndef SHAPES_HPP
+#define SHAPES_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+struct BoundingBox
+{
+    int w, h;
+};
+
+struct Color
+{
+    uint8_t r, g, b;
+};
+
+struct Rect
+{
+    int w, h;
+    Color color;
+
+    void draw() const
+    {
+        std::string buffer;
+        draw(buffer);
+        std::cout << buffer;
+    }
+
+    // appends the output to buffer - used for batched rendering
+    void draw(std::string& buffer) const
+    {
+        buffer += "Rect::draw()\n";
+    }
+
+    BoundingBox box() const noexcept
+    {
+        return BoundingBox{w, h};
+    }
+};
+
+struct ColorRect : Rect
+{
+    Color color;
+
+    Color get_color() const noexcept
+    {
+        return color;
+    }
+
+    void set_color(Color new_color)
+    {
+        color = new_color;
+    }
+};
+
+// clang-format off
+template <typename T>
+concept Shape = requires(const T& obj)
+{
+    { obj.box() } noexcept -> std::same_as<BoundingBox>;
+    obj.draw();
+};
+// clang-format on
+
+template <typename T>
+concept ShapeWithColor = Shape<T> && requires(T obj, Color color) {
+    { obj.get_color() } -> std::same_as<Color>;
+    obj.set_color(color);
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef SEGMENTED_ITERATOR_HPP
+#define SEGMENTED_ITERATOR_HPP
+
+#include <deque>
+#include <iterator>
+
+namespace helpers
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // segmented iterators - iterators over a sequence of contiguous blocks (e.g. std::deque)
+    //
+    // segmented_iterator_traits<It>::block_end(it) returns the end of the block holding *it.
+    // Only libstdc++ deque iterators are recognized - other iterators get the generic fallback
+    // (is_segmented == false). Specialize it for other segmented containers.
+
+    template <typename It>
+    struct segmented_iterator_traits
+    {
+        static constexpr bool is_segmented = false;
+    };
+
+#if defined(__GLIBCXX__)
+    template <typename T, typename Ref, typename Ptr>
+    struct segmented_iterator_traits<std::_Deque_iterator<T, Ref, Ptr>>
+    {
+        static constexpr bool is_segmented = true;
+
+        static Ptr block_end(const std::_Deque_iterator<T, Ref, Ptr>& it) noexcept
+        {
+            return it._M_last;
+        }
+    };
+#endif
+} // namespace helpers
+
+#endif
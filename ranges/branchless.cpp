@@ -0,0 +1,158 @@
+#include "branchless.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <ranges>
+#include <vector>
+
+namespace
+{
+    std::vector<int> random_ints(size_t size, int low = -1000, int high = 1000)
+    {
+        std::mt19937 rnd_gen{42};
+        std::uniform_int_distribution<int> distr{low, high};
+
+        std::vector<int> data(size);
+        std::ranges::generate(data, [&] { return distr(rnd_gen); });
+        return data;
+    }
+
+    auto is_even = [](int x) { return x % 2 == 0; };
+} // namespace
+
+TEST_CASE("branchless - masked assign", "[ranges][branchless]")
+{
+    std::vector data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    SECTION("the same result as assigning through views::filter")
+    {
+        auto expected = data;
+        for (auto& item : expected | std::views::filter(is_even))
+            item = 0;
+
+        ModernCpp::masked_assign(data, is_even, 0);
+
+        REQUIRE(data == expected);
+    }
+
+    SECTION("masked transform")
+    {
+        ModernCpp::masked_transform(data, is_even, [](int x) { return x * 10; });
+
+        REQUIRE(data == std::vector{1, 20, 3, 40, 5, 60, 7, 80, 9, 100});
+    }
+}
+
+TEST_CASE("branchless - compaction", "[ranges][branchless]")
+{
+    SECTION("compact keeps the order of selected items")
+    {
+        for (size_t size : {0, 1, 7, 8, 15, 16, 17, 33, 1000})
+        {
+            auto data = random_ints(size);
+
+            std::vector<int> expected;
+            std::ranges::copy_if(data, std::back_inserter(expected), is_even);
+
+            auto kept = ModernCpp::compact(data, is_even);
+
+            REQUIRE(std::ranges::equal(kept, expected));
+        }
+    }
+
+    SECTION("every instruction set supported by the CPU gives the same result")
+    {
+        const auto best = ModernCpp::best_compaction_isa();
+
+        for (auto instruction_set : {ModernCpp::compaction_isa::scalar, ModernCpp::compaction_isa::avx2, ModernCpp::compaction_isa::avx512})
+        {
+            if (instruction_set > best)
+                continue;
+
+            for (size_t size = 0; size < 100; ++size)
+            {
+                auto data = random_ints(size, -3, 3);
+
+                std::vector<int> expected;
+                std::ranges::copy_if(data, std::back_inserter(expected), is_even);
+
+                auto kept = ModernCpp::compact(instruction_set, data, is_even);
+
+                REQUIRE(std::ranges::equal(kept, expected));
+            }
+
+            std::vector<int> all_kept(37, 2);
+            REQUIRE(ModernCpp::compact(instruction_set, all_kept, is_even).size() == 37);
+
+            std::vector<int> none_kept(37, 1);
+            REQUIRE(ModernCpp::compact(instruction_set, none_kept, is_even).empty());
+        }
+    }
+
+    SECTION("remove_if + erase")
+    {
+        auto data = random_ints(1000);
+        auto expected = data;
+        std::erase_if(expected, is_even);
+
+        auto removed = ModernCpp::remove_if(data, is_even);
+        data.erase(data.begin() + (removed.data() - data.data()), data.end());
+
+        REQUIRE(data == expected);
+    }
+
+    SECTION("stable partition")
+    {
+        auto data = random_ints(1000);
+        auto expected = data;
+        auto expected_tail = std::ranges::stable_partition(expected, is_even);
+
+        auto tail = ModernCpp::stable_partition(data, is_even);
+
+        REQUIRE(data == expected);
+        REQUIRE(tail.size() == expected_tail.size());
+    }
+
+    SECTION("8-byte items use scalar branchless path")
+    {
+        std::vector<double> data = {1.0, -2.0, 3.0, -4.0, 5.0};
+
+        auto kept = ModernCpp::compact(data, [](double x) { return x > 0.0; });
+
+        REQUIRE(std::ranges::equal(kept, std::vector{1.0, 3.0, 5.0}));
+    }
+}
+
+TEST_CASE("branchless vs filter", "[ranges][branchless][.benchmark]")
+{
+    const auto source = random_ints(10'000'000);
+
+    BENCHMARK("views::filter - zero evens")
+    {
+        auto data = source;
+        for (auto& item : data | std::views::filter(is_even))
+            item = 0;
+        return data.back();
+    };
+
+    BENCHMARK("masked_assign - zero evens")
+    {
+        auto data = source;
+        ModernCpp::masked_assign(data, is_even, 0);
+        return data.back();
+    };
+
+    BENCHMARK("std::remove_if")
+    {
+        auto data = source;
+        return std::remove_if(data.begin(), data.end(), is_even) - data.begin();
+    };
+
+    BENCHMARK("ModernCpp::remove_if")
+    {
+        auto data = source;
+        return ModernCpp::remove_if(data, is_even).size();
+    };
+}
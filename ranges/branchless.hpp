@@ -0,0 +1,238 @@
+#ifndef BRANCHLESS_HPP
+#define BRANCHLESS_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MODERNCPP_BRANCHLESS_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // branchless in-place operations over contiguous ranges
+    //
+    // The views::filter way of updating selected items (for(auto& x : data | views::filter(pred)) x = 0;)
+    // has a data-dependent branch per item. The algorithms below always do the same work per item
+    // and select results with masks, so they vectorize and do not suffer from branch mispredictions.
+    // Compaction of 4-byte items uses AVX-512 compress stores or an AVX2 permutation table -
+    // both are compiled with target attributes & selected at runtime, so no -mavx2 is required.
+
+    // clang-format off
+    template <typename R>
+    concept BranchlessRange = std::ranges::contiguous_range<R>
+        && std::ranges::sized_range<R>
+        && std::ranges::output_range<R, std::ranges::range_value_t<R>>
+        && std::is_trivially_copyable_v<std::ranges::range_value_t<R>>;
+    // clang-format on
+
+    template <BranchlessRange R>
+    using branchless_span_t = std::span<std::ranges::range_value_t<R>>;
+
+    template <BranchlessRange R, std::predicate<const std::ranges::range_value_t<R>&> Pred>
+    void masked_assign(R&& rng, Pred pred, const std::ranges::range_value_t<R>& value)
+    {
+        for (auto& item : rng)
+            item = pred(item) ? value : item;
+    }
+
+    template <BranchlessRange R, std::predicate<const std::ranges::range_value_t<R>&> Pred,
+        std::regular_invocable<const std::ranges::range_value_t<R>&> F>
+    void masked_transform(R&& rng, Pred pred, F f)
+    {
+        for (auto& item : rng)
+        {
+            const std::ranges::range_value_t<R> result = f(item);
+            item = pred(item) ? result : item;
+        }
+    }
+
+    enum class compaction_isa
+    {
+        scalar,
+        avx2,
+        avx512
+    };
+
+    inline compaction_isa detect_compaction_isa() noexcept
+    {
+#ifdef MODERNCPP_BRANCHLESS_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return compaction_isa::avx512;
+        if (__builtin_cpu_supports("avx2"))
+            return compaction_isa::avx2;
+#endif
+        return compaction_isa::scalar;
+    }
+
+    // the instruction set used by compact/remove_if called without an explicit isa
+    inline compaction_isa best_compaction_isa() noexcept
+    {
+        static const compaction_isa detected = detect_compaction_isa();
+        return detected;
+    }
+
+    namespace detail
+    {
+        // every item is written, the output position advances only for kept items
+        template <typename T, typename Pred>
+        size_t compact_scalar(T* data, size_t first, size_t last, size_t out, Pred& keep)
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                const T item = data[i];
+                data[out] = item;
+                out += static_cast<bool>(keep(item));
+            }
+            return out;
+        }
+
+        template <size_t Lanes, typename T, typename Pred>
+        unsigned block_mask(const T* block, Pred& keep)
+        {
+            unsigned mask = 0;
+            for (size_t lane = 0; lane < Lanes; ++lane)
+                mask |= static_cast<unsigned>(static_cast<bool>(keep(block[lane]))) << lane;
+            return mask;
+        }
+
+#ifdef MODERNCPP_BRANCHLESS_X86_DISPATCH
+        // for every 8-bit mask: indices of set bits moved to the front
+        inline constexpr auto compress_permutations = [] {
+            std::array<std::array<std::int32_t, 8>, 256> table{};
+            for (unsigned mask = 0; mask < 256; ++mask)
+            {
+                size_t out = 0;
+                for (int lane = 0; lane < 8; ++lane)
+                {
+                    if (mask & (1u << lane))
+                        table[mask][out++] = lane;
+                }
+            }
+            return table;
+        }();
+
+        template <typename T, typename Pred>
+        [[gnu::target("avx512f")]] size_t compact_avx512(T* data, size_t size, Pred& keep)
+        {
+            size_t out = 0;
+            size_t i = 0;
+
+            for (; i + 16 <= size; i += 16)
+            {
+                const __mmask16 mask = static_cast<__mmask16>(block_mask<16>(data + i, keep));
+                const __m512i items = _mm512_loadu_si512(data + i);
+                _mm512_mask_compressstoreu_epi32(data + out, mask, items);
+                out += std::popcount(static_cast<unsigned>(mask));
+            }
+
+            return compact_scalar(data, i, size, out, keep);
+        }
+
+        template <typename T, typename Pred>
+        [[gnu::target("avx2")]] size_t compact_avx2(T* data, size_t size, Pred& keep)
+        {
+            size_t out = 0;
+            size_t i = 0;
+
+            for (; i + 8 <= size; i += 8)
+            {
+                const unsigned mask = block_mask<8>(data + i, keep);
+                const __m256i items = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i permutation = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(compress_permutations[mask].data()));
+                // out <= i - the store never reaches items that are not loaded yet
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + out), _mm256_permutevar8x32_epi32(items, permutation));
+                out += std::popcount(mask);
+            }
+
+            return compact_scalar(data, i, size, out, keep);
+        }
+#endif
+
+        template <typename T, typename Pred>
+        size_t compact(compaction_isa instruction_set, T* data, size_t size, Pred& keep)
+        {
+#ifdef MODERNCPP_BRANCHLESS_X86_DISPATCH
+            if constexpr (sizeof(T) == 4)
+            {
+                switch (instruction_set)
+                {
+                case compaction_isa::avx512:
+                    return compact_avx512(data, size, keep);
+                case compaction_isa::avx2:
+                    return compact_avx2(data, size, keep);
+                default:
+                    break;
+                }
+            }
+#endif
+            (void)instruction_set;
+            return compact_scalar(data, 0, size, 0, keep);
+        }
+    } // namespace detail
+
+    // stable: moves items satisfying keep to the front, returns them as a subspan
+    template <BranchlessRange R, std::predicate<const std::ranges::range_value_t<R>&> Pred>
+    branchless_span_t<R> compact(compaction_isa instruction_set, R&& rng, Pred keep)
+    {
+        branchless_span_t<R> data{rng};
+        return data.first(detail::compact(instruction_set, data.data(), data.size(), keep));
+    }
+
+    template <BranchlessRange R, std::predicate<const std::ranges::range_value_t<R>&> Pred>
+    branchless_span_t<R> compact(R&& rng, Pred keep)
+    {
+        return compact(best_compaction_isa(), rng, std::move(keep));
+    }
+
+    // like std::ranges::remove_if - returns the tail of the range that should be erased
+    template <BranchlessRange R, std::predicate<const std::ranges::range_value_t<R>&> Pred>
+    branchless_span_t<R> remove_if(R&& rng, Pred pred)
+    {
+        branchless_span_t<R> data{rng};
+        auto keep = [&pred](const auto& item) { return !pred(item); };
+        return data.subspan(detail::compact(best_compaction_isa(), data.data(), data.size(), keep));
+    }
+
+    // like std::ranges::stable_partition - returns the second group (items not satisfying pred)
+    template <BranchlessRange R, std::predicate<const std::ranges::range_value_t<R>&> Pred>
+        requires std::default_initializable<std::ranges::range_value_t<R>>
+    branchless_span_t<R> stable_partition(R&& rng, Pred pred)
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        branchless_span_t<R> data{rng};
+        std::vector<T> rejected(data.size());
+        size_t rejected_count = 0;
+        size_t out = 0;
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            const T item = data[i];
+            const bool selected = static_cast<bool>(pred(item));
+            data[out] = item;
+            rejected[rejected_count] = item;
+            out += selected;
+            rejected_count += !selected;
+        }
+
+        std::copy_n(rejected.begin(), rejected_count, data.begin() + out);
+
+        return data.subspan(out);
+    }
+} // namespace ModernCpp
+
+#endif
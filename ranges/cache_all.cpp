@@ -0,0 +1,96 @@
+#include "cache_all.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <helpers.hpp>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+static_assert(std::ranges::random_access_range<ModernCpp::cached_view<int>>);
+static_assert(std::ranges::sized_range<ModernCpp::cached_view<int>>);
+static_assert(std::ranges::view<ModernCpp::cached_view<int>>);
+
+TEST_CASE("views::cache_all", "[ranges][views]")
+{
+    int transform_calls = 0;
+    int filter_calls = 0;
+
+    auto square = [&](int x) { ++transform_calls; return x * x; };
+    auto is_even = [&](int x) { ++filter_calls; return x % 2 == 0; };
+
+    SECTION("reverse over filtered view re-evaluates lambdas on every traversal")
+    {
+        auto items = std::views::iota(1)
+            | std::views::take(10)
+            | std::views::transform(square)
+            | std::views::filter(is_even)
+            | std::views::reverse;
+
+        std::ranges::for_each(items, [](int) { });
+        const int calls_after_first_pass = transform_calls;
+        std::ranges::for_each(items, [](int) { });
+
+        REQUIRE(transform_calls > calls_after_first_pass);
+    }
+
+    SECTION("pipeline is evaluated once")
+    {
+        auto items = std::views::iota(1)
+            | std::views::take(10)
+            | std::views::transform(square)
+            | std::views::filter(is_even)
+            | ModernCpp::views::cache_all;
+
+        const int transform_calls_after_caching = transform_calls;
+        REQUIRE(filter_calls == 10);
+
+        auto reversed = items | std::views::reverse;
+        REQUIRE(std::ranges::equal(reversed, std::vector{100, 64, 36, 16, 4}));
+        REQUIRE(std::ranges::equal(reversed, std::vector{100, 64, 36, 16, 4}));
+        REQUIRE(items[2] == 36);
+        REQUIRE(items.size() == 5);
+
+        REQUIRE(transform_calls == transform_calls_after_caching);
+        REQUIRE(filter_calls == 10);
+
+        helpers::print(reversed, "cached items");
+    }
+
+    SECTION("items span many chunks")
+    {
+        constexpr int n = 3 * ModernCpp::chunked_buffer<int>::chunk_size + 7;
+
+        auto items = std::views::iota(0, n) | std::views::transform(square) | ModernCpp::views::cache_all;
+
+        REQUIRE(items.size() == n);
+        REQUIRE(std::ranges::equal(items, std::views::iota(0, n) | std::views::transform([](int x) { return x * x; })));
+    }
+
+    SECTION("parallel materialization")
+    {
+        constexpr int n = 100'000;
+        std::vector<int> data(n);
+        std::iota(data.begin(), data.end(), 0);
+
+        auto expensive = [](int x) { return x * 3 + 1; };
+
+        auto items = data | std::views::transform(expensive) | ModernCpp::views::cache_all(ModernCpp::parallel, 4);
+
+        REQUIRE(items.size() == n);
+        REQUIRE(std::ranges::equal(items, data | std::views::transform(expensive)));
+    }
+
+    SECTION("parallel with more threads than chunks")
+    {
+        auto items = std::views::iota(0, 10) | ModernCpp::views::cache_all(ModernCpp::parallel, 64);
+
+        REQUIRE(std::ranges::equal(items, std::views::iota(0, 10)));
+    }
+
+    SECTION("empty range")
+    {
+        auto items = std::views::empty<int> | ModernCpp::views::cache_all(ModernCpp::parallel);
+
+        REQUIRE(items.empty());
+    }
+}
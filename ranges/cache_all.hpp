@@ -0,0 +1,298 @@
+#ifndef CACHE_ALL_HPP
+#define CACHE_ALL_HPP
+
+#include "parallel_pipeline.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace ModernCpp
+{
+    inline constexpr struct parallel_t
+    {
+    } parallel;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // chunked_buffer - owning storage for materialized range items
+    //
+    // Items live in fixed-size chunks (~16KB each): growing never relocates already stored items
+    // and chunks can be filled independently by many threads.
+    template <typename T>
+    class chunked_buffer
+    {
+        std::vector<std::vector<T>> chunks_;
+        size_t size_ = 0;
+
+    public:
+        static constexpr size_t chunk_size = std::max<size_t>(1, 16 * 1024 / sizeof(T));
+
+        chunked_buffer() = default;
+
+        template <std::ranges::input_range R>
+        explicit chunked_buffer(R&& rng)
+        {
+            for (auto&& item : rng)
+                push_back(std::forward<decltype(item)>(item));
+        }
+
+        template <std::ranges::random_access_range R>
+            requires std::ranges::sized_range<R>
+        chunked_buffer(parallel_t, R&& rng, unsigned thread_count = std::thread::hardware_concurrency())
+        {
+            size_ = std::ranges::size(rng);
+            chunks_.resize((size_ + chunk_size - 1) / chunk_size);
+
+            // begin() of some views is not thread-safe (it may cache) - it is evaluated once here
+            const auto first = std::ranges::begin(rng);
+
+            thread_executor{thread_count}.bulk_execute(chunks_.size(), [this, first](size_t c) {
+                const size_t item_first = c * chunk_size;
+                const size_t item_last = std::min(size_, item_first + chunk_size);
+
+                auto& chunk = chunks_[c];
+                chunk.reserve(item_last - item_first);
+                for (size_t i = item_first; i < item_last; ++i)
+                    chunk.push_back(first[static_cast<std::ranges::range_difference_t<R>>(i)]);
+            });
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        template <typename U>
+        void push_back(U&& item)
+        {
+            if (size_ % chunk_size == 0)
+            {
+                chunks_.emplace_back();
+                chunks_.back().reserve(chunk_size);
+            }
+
+            chunks_.back().push_back(std::forward<U>(item));
+            ++size_;
+        }
+
+        T& operator[](size_t index) noexcept
+        {
+            return chunks_[index / chunk_size][index % chunk_size];
+        }
+
+        const T& operator[](size_t index) const noexcept
+        {
+            return chunks_[index / chunk_size][index % chunk_size];
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cached_view - random-access view sharing ownership of a materialized chunked_buffer
+
+    template <typename T>
+    class cached_view : public std::ranges::view_interface<cached_view<T>>
+    {
+        std::shared_ptr<const chunked_buffer<T>> buffer_;
+
+    public:
+        class iterator
+        {
+            const chunked_buffer<T>* buffer_ = nullptr;
+            std::ptrdiff_t index_ = 0;
+
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = const T&;
+            using pointer = const T*;
+
+            iterator() = default;
+
+            iterator(const chunked_buffer<T>* buffer, std::ptrdiff_t index)
+                : buffer_{buffer}
+                , index_{index}
+            { }
+
+            const T& operator*() const
+            {
+                return (*buffer_)[static_cast<size_t>(index_)];
+            }
+
+            const T* operator->() const
+            {
+                return &**this;
+            }
+
+            const T& operator[](difference_type n) const
+            {
+                return (*buffer_)[static_cast<size_t>(index_ + n)];
+            }
+
+            iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto tmp = *this;
+                ++index_;
+                return tmp;
+            }
+
+            iterator& operator--()
+            {
+                --index_;
+                return *this;
+            }
+
+            iterator operator--(int)
+            {
+                auto tmp = *this;
+                --index_;
+                return tmp;
+            }
+
+            iterator& operator+=(difference_type n)
+            {
+                index_ += n;
+                return *this;
+            }
+
+            iterator& operator-=(difference_type n)
+            {
+                index_ -= n;
+                return *this;
+            }
+
+            friend iterator operator+(iterator it, difference_type n)
+            {
+                return it += n;
+            }
+
+            friend iterator operator+(difference_type n, iterator it)
+            {
+                return it += n;
+            }
+
+            friend iterator operator-(iterator it, difference_type n)
+            {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const iterator& lhs, const iterator& rhs)
+            {
+                return lhs.index_ - rhs.index_;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+
+            auto operator<=>(const iterator& other) const
+            {
+                return index_ <=> other.index_;
+            }
+        };
+
+        cached_view() = default;
+
+        explicit cached_view(chunked_buffer<T> buffer)
+            : buffer_{std::make_shared<const chunked_buffer<T>>(std::move(buffer))}
+        { }
+
+        iterator begin() const
+        {
+            return iterator{buffer_.get(), 0};
+        }
+
+        iterator end() const
+        {
+            return iterator{buffer_.get(), static_cast<std::ptrdiff_t>(size())};
+        }
+
+        size_t size() const noexcept
+        {
+            return buffer_ ? buffer_->size() : 0;
+        }
+    };
+
+    template <std::ranges::input_range R>
+    chunked_buffer<std::ranges::range_value_t<R>> to_chunked_buffer(R&& rng)
+    {
+        return chunked_buffer<std::ranges::range_value_t<R>>(std::forward<R>(rng));
+    }
+
+    template <std::ranges::random_access_range R>
+        requires std::ranges::sized_range<R>
+    chunked_buffer<std::ranges::range_value_t<R>> to_chunked_buffer(parallel_t, R&& rng,
+        unsigned thread_count = std::thread::hardware_concurrency())
+    {
+        return chunked_buffer<std::ranges::range_value_t<R>>(parallel, std::forward<R>(rng), thread_count);
+    }
+
+    namespace views
+    {
+        ////////////////////////////////////////////////////////////////////////////////
+        // views::cache_all - evaluates an upstream pipeline once
+        //
+        //   auto items = data | views::filter(...) | views::transform(...) | ModernCpp::views::cache_all;
+        //   auto items = data | views::transform(...) | ModernCpp::views::cache_all(ModernCpp::parallel);
+
+        struct cache_all_parallel_fn
+        {
+            unsigned thread_count;
+
+            template <std::ranges::random_access_range R>
+                requires std::ranges::sized_range<R>
+            auto operator()(R&& rng) const
+            {
+                return cached_view(to_chunked_buffer(parallel, std::forward<R>(rng), thread_count));
+            }
+
+            template <std::ranges::random_access_range R>
+                requires std::ranges::sized_range<R>
+            friend auto operator|(R&& rng, const cache_all_parallel_fn& fn)
+            {
+                return fn(std::forward<R>(rng));
+            }
+        };
+
+        struct cache_all_fn
+        {
+            template <std::ranges::input_range R>
+            auto operator()(R&& rng) const
+            {
+                return cached_view(to_chunked_buffer(std::forward<R>(rng)));
+            }
+
+            cache_all_parallel_fn operator()(parallel_t, unsigned thread_count = std::thread::hardware_concurrency()) const
+            {
+                return cache_all_parallel_fn{thread_count};
+            }
+
+            template <std::ranges::input_range R>
+            friend auto operator|(R&& rng, const cache_all_fn& fn)
+            {
+                return fn(std::forward<R>(rng));
+            }
+        };
+
+        inline constexpr cache_all_fn cache_all{};
+    } // namespace views
+} // namespace ModernCpp
+
+#endif
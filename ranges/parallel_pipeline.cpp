@@ -0,0 +1,96 @@
+#include "parallel_pipeline.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("parallel pipelines", "[ranges][parallel]")
+{
+    std::vector<int> data(1'000'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    auto is_even = [](int x) { return x % 2 == 0; };
+    auto square = [](int x) { return static_cast<long long>(x) * x; };
+
+    auto pipeline = std::views::filter(is_even) | std::views::transform(square);
+
+    auto sequential = data | pipeline;
+    const std::vector<long long> expected(sequential.begin(), sequential.end());
+
+    SECTION("collect - results are concatenated in source order")
+    {
+        auto result = ModernCpp::parallel_collect(data, pipeline, ModernCpp::thread_executor{4});
+
+        REQUIRE(result == expected);
+    }
+
+    SECTION("collect - callable taking a chunk as pipeline")
+    {
+        auto result = ModernCpp::parallel_collect(data, [](auto chunk) {
+            return chunk | std::views::transform([](int x) { return std::to_string(x); });
+        });
+
+        REQUIRE(result.size() == data.size());
+        REQUIRE(result.front() == "0");
+        REQUIRE(result.back() == "999999");
+    }
+
+    SECTION("reduce")
+    {
+        auto sum = ModernCpp::parallel_reduce(data, pipeline, 0LL);
+
+        REQUIRE(sum == std::accumulate(expected.begin(), expected.end(), 0LL));
+    }
+
+    SECTION("reduce - non-commutative op keeps order")
+    {
+        std::vector<std::string> words(10'000, "a");
+        words.front() = "<";
+        words.back() = ">";
+
+        auto text = ModernCpp::parallel_reduce(words, std::views::all, std::string{}, std::plus<>{}, ModernCpp::thread_executor{8});
+
+        REQUIRE(text.size() == words.size());
+        REQUIRE(text.front() == '<');
+        REQUIRE(text.back() == '>');
+    }
+
+    SECTION("inline executor gives the same result")
+    {
+        auto result = ModernCpp::parallel_collect(data, pipeline, ModernCpp::inline_executor{});
+
+        REQUIRE(result == expected);
+    }
+
+    SECTION("for_each")
+    {
+        std::atomic<long long> sum{0};
+
+        ModernCpp::parallel_for_each(data, pipeline, [&](long long x) { sum += x; });
+
+        REQUIRE(sum == std::accumulate(expected.begin(), expected.end(), 0LL));
+    }
+
+    SECTION("empty source")
+    {
+        std::vector<int> empty;
+
+        REQUIRE(ModernCpp::parallel_collect(empty, pipeline).empty());
+        REQUIRE(ModernCpp::parallel_reduce(empty, pipeline, 42LL) == 42);
+    }
+
+    SECTION("exception from a task is propagated")
+    {
+        auto throwing = std::views::transform([](int x) {
+            if (x == 500'000)
+                throw std::runtime_error("bad item");
+            return x;
+        });
+
+        REQUIRE_THROWS_AS(ModernCpp::parallel_collect(data, throwing), std::runtime_error);
+    }
+}
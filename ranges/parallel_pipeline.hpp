@@ -0,0 +1,213 @@
+#ifndef PARALLEL_PIPELINE_HPP
+#define PARALLEL_PIPELINE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // executors - run task(0), task(1), ..., task(n-1) and block until all of them are done
+
+    // clang-format off
+    template <typename E>
+    concept BulkExecutor = requires(E& ex, size_t n, void (*task)(size_t))
+    {
+        { ex.concurrency() } -> std::convertible_to<size_t>;
+        ex.bulk_execute(n, task);
+    };
+    // clang-format on
+
+    struct inline_executor
+    {
+        size_t concurrency() const noexcept
+        {
+            return 1;
+        }
+
+        template <std::invocable<size_t> Task>
+        void bulk_execute(size_t n, Task&& task) const
+        {
+            for (size_t i = 0; i < n; ++i)
+                task(i);
+        }
+    };
+
+    class thread_executor
+    {
+        size_t thread_count_;
+
+    public:
+        explicit thread_executor(size_t thread_count = std::thread::hardware_concurrency())
+            : thread_count_{std::max<size_t>(thread_count, 1)}
+        { }
+
+        size_t concurrency() const noexcept
+        {
+            return thread_count_;
+        }
+
+        // tasks are picked dynamically from a shared counter - the calling thread also takes part;
+        // the first exception thrown by a task is rethrown after all workers are joined
+        template <std::invocable<size_t> Task>
+        void bulk_execute(size_t n, Task&& task) const
+        {
+            std::atomic<size_t> next_task{0};
+            std::exception_ptr error;
+            std::once_flag error_flag;
+
+            auto worker = [&] {
+                for (size_t i = next_task++; i < n; i = next_task++)
+                {
+                    try
+                    {
+                        task(i);
+                    }
+                    catch (...)
+                    {
+                        std::call_once(error_flag, [&] { error = std::current_exception(); });
+                        next_task = n;
+                    }
+                }
+            };
+
+            {
+                std::vector<std::jthread> workers;
+                const size_t worker_count = std::min(thread_count_, n);
+
+                for (size_t w = 1; w < worker_count; ++w)
+                    workers.emplace_back(worker);
+
+                worker();
+            }
+
+            if (error)
+                std::rethrow_exception(error);
+        }
+    };
+
+    static_assert(BulkExecutor<inline_executor>);
+    static_assert(BulkExecutor<thread_executor>);
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // parallel pipelines over random-access sized sources
+    //
+    // The source is split into contiguous chunks, the pipeline (a range adaptor closure
+    // like views::filter(...) | views::transform(...), or any callable taking a subrange)
+    // is applied to every chunk independently and the results are combined in source order.
+    //
+    //   auto result = parallel_collect(data, std::views::filter(pred) | std::views::transform(f));
+
+    namespace detail
+    {
+        inline constexpr size_t min_items_per_chunk = 4096;
+
+        template <typename R>
+        using chunk_t = std::ranges::subrange<std::ranges::iterator_t<R>>;
+
+        template <typename R, typename Pipeline>
+        using pipeline_result_t = std::invoke_result_t<Pipeline&, chunk_t<R>>;
+
+        template <std::ranges::random_access_range R, BulkExecutor Executor, typename F>
+        void for_each_chunk(R& source, const Executor& executor, size_t chunk_count, F&& f)
+        {
+            const auto first = std::ranges::begin(source);
+            const auto size = std::ranges::distance(source);
+
+            executor.bulk_execute(chunk_count, [&](size_t c) {
+                const auto chunk_first = first + static_cast<std::ranges::range_difference_t<R>>(c * size / chunk_count);
+                const auto chunk_last = first + static_cast<std::ranges::range_difference_t<R>>((c + 1) * size / chunk_count);
+                f(c, chunk_t<R>{chunk_first, chunk_last});
+            });
+        }
+
+        template <typename R, typename Executor>
+        size_t chunk_count_for(R& source, const Executor& executor)
+        {
+            const auto size = static_cast<size_t>(std::ranges::distance(source));
+            const size_t max_chunks = std::max<size_t>(1, size / min_items_per_chunk);
+            // a few chunks per thread - evens out unbalanced filters
+            return std::min(max_chunks, executor.concurrency() * 4);
+        }
+    } // namespace detail
+
+    template <std::ranges::random_access_range R, typename Pipeline, BulkExecutor Executor = thread_executor>
+        requires std::ranges::sized_range<R> && std::ranges::input_range<detail::pipeline_result_t<R, Pipeline>>
+    auto parallel_collect(R&& source, Pipeline pipeline, const Executor& executor = Executor{})
+    {
+        using Result = std::ranges::range_value_t<detail::pipeline_result_t<R, Pipeline>>;
+
+        const size_t chunk_count = detail::chunk_count_for(source, executor);
+        std::vector<std::vector<Result>> partial_results(chunk_count);
+
+        detail::for_each_chunk(source, executor, chunk_count, [&](size_t c, auto chunk) {
+            for (auto&& item : std::invoke(pipeline, chunk))
+                partial_results[c].push_back(std::forward<decltype(item)>(item));
+        });
+
+        size_t total_size = 0;
+        for (const auto& part : partial_results)
+            total_size += part.size();
+
+        std::vector<Result> result;
+        result.reserve(total_size);
+        for (auto& part : partial_results)
+            std::ranges::move(part, std::back_inserter(result));
+
+        return result;
+    }
+
+    // op must be associative - partial results of chunks are combined left to right
+    template <std::ranges::random_access_range R, typename Pipeline, typename T, typename BinaryOp = std::plus<>,
+        BulkExecutor Executor = thread_executor>
+        requires std::ranges::sized_range<R> && std::ranges::input_range<detail::pipeline_result_t<R, Pipeline>>
+    T parallel_reduce(R&& source, Pipeline pipeline, T init, BinaryOp op = {}, const Executor& executor = Executor{})
+    {
+        const size_t chunk_count = detail::chunk_count_for(source, executor);
+        std::vector<std::optional<T>> partial_results(chunk_count);
+
+        detail::for_each_chunk(source, executor, chunk_count, [&](size_t c, auto chunk) {
+            std::optional<T>& partial = partial_results[c];
+            for (auto&& item : std::invoke(pipeline, chunk))
+            {
+                if (partial)
+                    *partial = op(std::move(*partial), std::forward<decltype(item)>(item));
+                else
+                    partial.emplace(std::forward<decltype(item)>(item));
+            }
+        });
+
+        for (auto& partial : partial_results)
+        {
+            if (partial)
+                init = op(std::move(init), std::move(*partial));
+        }
+
+        return init;
+    }
+
+    template <std::ranges::random_access_range R, typename Pipeline, typename F, BulkExecutor Executor = thread_executor>
+        requires std::ranges::sized_range<R> && std::ranges::input_range<detail::pipeline_result_t<R, Pipeline>>
+    void parallel_for_each(R&& source, Pipeline pipeline, F f, const Executor& executor = Executor{})
+    {
+        const size_t chunk_count = detail::chunk_count_for(source, executor);
+
+        detail::for_each_chunk(source, executor, chunk_count, [&](size_t, auto chunk) {
+            for (auto&& item : std::invoke(pipeline, chunk))
+                std::invoke(f, std::forward<decltype(item)>(item));
+        });
+    }
+} // namespace ModernCpp
+
+#endif
@@ -1,3 +1,5 @@
+#include "sentinel.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <helpers.hpp>
 #include <iostream>
@@ -11,15 +13,6 @@
 
 using namespace std::literals;
 
-template <auto Value>
-struct Sentinel
-{
-    bool operator==(auto it) const
-    {
-        return *it == Value;
-    }
-};
-
 TEST_CASE("ranges", "[ranges]")
 {
     // auto data = helpers::create_numeric_dataset<20>(42);
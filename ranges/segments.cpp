@@ -0,0 +1,134 @@
+#include "segments.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+static_assert(std::ranges::forward_range<ModernCpp::segments_view<std::ranges::ref_view<std::deque<int>>>>);
+
+TEST_CASE("views::segments", "[ranges][segments]")
+{
+    SECTION("vector is a single segment")
+    {
+        std::vector<int> vec(100);
+
+        auto segments = vec | ModernCpp::views::segments;
+
+        REQUIRE(std::ranges::distance(segments) == 1);
+        REQUIRE((*segments.begin()).size() == 100);
+    }
+
+    SECTION("deque blocks are exposed as contiguous spans")
+    {
+        std::deque<int> data(10'000);
+        std::iota(data.begin(), data.end(), 0);
+
+        size_t total_size = 0;
+        size_t segment_count = 0;
+        int expected = 0;
+
+        for (std::span<int> segment : data | ModernCpp::views::segments)
+        {
+            REQUIRE(!segment.empty());
+            for (int item : segment)
+                REQUIRE(item == expected++);
+
+            total_size += segment.size();
+            ++segment_count;
+        }
+
+        REQUIRE(total_size == data.size());
+        REQUIRE(segment_count > 1);
+    }
+
+    SECTION("subrange of a deque")
+    {
+        std::deque<int> data(1'000);
+        std::iota(data.begin(), data.end(), 0);
+
+        auto middle = std::ranges::subrange(data.begin() + 100, data.begin() + 900);
+
+        size_t total_size = 0;
+        for (auto segment : ModernCpp::views::segments(middle))
+            total_size += segment.size();
+
+        REQUIRE(total_size == 800);
+        REQUIRE(ModernCpp::segmented_accumulate(middle, 0LL) == std::accumulate(middle.begin(), middle.end(), 0LL));
+    }
+
+    SECTION("empty deque")
+    {
+        std::deque<int> data;
+
+        REQUIRE(std::ranges::distance(data | ModernCpp::views::segments) == 0);
+    }
+}
+
+TEST_CASE("segmented algorithms", "[ranges][segments]")
+{
+    std::deque<int> data(5'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    SECTION("fill")
+    {
+        ModernCpp::segmented_fill(data, 42);
+
+        REQUIRE(std::ranges::all_of(data, [](int x) { return x == 42; }));
+    }
+
+    SECTION("copy")
+    {
+        std::vector<int> target(data.size());
+
+        auto out = ModernCpp::segmented_copy(data, target.begin());
+
+        REQUIRE(out == target.end());
+        REQUIRE(std::ranges::equal(data, target));
+    }
+
+    SECTION("transform")
+    {
+        std::vector<int> target;
+        ModernCpp::segmented_transform(data, std::back_inserter(target), [](int x) { return x * 2; });
+
+        ModernCpp::segmented_transform(data, [](int x) { return x * 2; });
+
+        REQUIRE(std::ranges::equal(data, target));
+        REQUIRE(data.back() == 9'998);
+    }
+
+    SECTION("accumulate")
+    {
+        REQUIRE(ModernCpp::segmented_accumulate(data, 0) == std::accumulate(data.begin(), data.end(), 0));
+    }
+}
+
+TEST_CASE("segmented accumulate vs std::accumulate over deque", "[ranges][segments][.benchmark]")
+{
+    std::deque<int> data(100'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    BENCHMARK("std::accumulate")
+    {
+        return std::accumulate(data.begin(), data.end(), 0LL);
+    };
+
+    BENCHMARK("segmented_accumulate")
+    {
+        return ModernCpp::segmented_accumulate(data, 0LL);
+    };
+
+    BENCHMARK("std::fill")
+    {
+        std::fill(data.begin(), data.end(), 1);
+    };
+
+    BENCHMARK("segmented_fill")
+    {
+        ModernCpp::segmented_fill(data, 1);
+    };
+}
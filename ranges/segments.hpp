@@ -0,0 +1,234 @@
+#ifndef SEGMENTS_HPP
+#define SEGMENTS_HPP
+
+#include "segmented_iterator.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // segmented ranges - std::deque & co. seen as a sequence of contiguous blocks
+    //
+    // Incrementing a deque iterator checks for the end of a block on every step, which blocks
+    // vectorization. views::segments exposes the blocks as std::spans, so inner loops
+    // run over plain contiguous memory.
+
+    template <typename It>
+    concept SegmentableIterator = std::random_access_iterator<It>
+        && std::is_lvalue_reference_v<std::iter_reference_t<It>>;
+
+    template <SegmentableIterator It>
+    using segment_t = std::span<std::remove_reference_t<std::iter_reference_t<It>>>;
+
+    // the longest contiguous block starting at first - never reaches past last
+    template <SegmentableIterator It>
+    segment_t<It> next_segment(It first, It last)
+    {
+        if (first == last)
+            return {};
+
+        if constexpr (std::contiguous_iterator<It>)
+        {
+            return segment_t<It>{std::to_address(first), static_cast<size_t>(last - first)};
+        }
+        else if constexpr (helpers::segmented_iterator_traits<It>::is_segmented)
+        {
+            // the iterator knows the end of its current block
+            auto* const start = std::addressof(*first);
+            auto* const block_last = helpers::segmented_iterator_traits<It>::block_end(first);
+            return segment_t<It>{start, std::min(static_cast<size_t>(block_last - start), static_cast<size_t>(last - first))};
+        }
+        else
+        {
+            // generic fallback - extends the segment as long as items are adjacent in memory
+            auto* const start = std::addressof(*first);
+            std::iter_difference_t<It> length = 1;
+
+            for (auto it = std::next(first); it != last && std::addressof(*it) == start + length; ++it)
+                ++length;
+
+            return segment_t<It>{start, static_cast<size_t>(length)};
+        }
+    }
+
+    template <std::ranges::view V>
+        requires SegmentableIterator<std::ranges::iterator_t<V>> && std::ranges::common_range<V>
+    class segments_view : public std::ranges::view_interface<segments_view<V>>
+    {
+        using base_iterator = std::ranges::iterator_t<V>;
+
+        V base_ = V();
+
+    public:
+        class iterator
+        {
+            base_iterator current_{};
+            base_iterator last_{};
+            segment_t<base_iterator> segment_{};
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = segment_t<base_iterator>;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            iterator(base_iterator first, base_iterator last)
+                : current_{first}
+                , last_{last}
+                , segment_{next_segment(first, last)}
+            { }
+
+            value_type operator*() const
+            {
+                return segment_;
+            }
+
+            iterator& operator++()
+            {
+                current_ += static_cast<std::iter_difference_t<base_iterator>>(segment_.size());
+                segment_ = next_segment(current_, last_);
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return current_ == other.current_;
+            }
+
+            bool operator==(std::default_sentinel_t) const
+            {
+                return current_ == last_;
+            }
+        };
+
+        segments_view() = default;
+
+        explicit segments_view(V base)
+            : base_{std::move(base)}
+        { }
+
+        iterator begin() const
+            requires std::ranges::range<const V>
+        {
+            return iterator{std::ranges::begin(base_), std::ranges::end(base_)};
+        }
+
+        iterator begin()
+        {
+            return iterator{std::ranges::begin(base_), std::ranges::end(base_)};
+        }
+
+        std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+    };
+
+    template <typename R>
+    segments_view(R&&) -> segments_view<std::views::all_t<R>>;
+
+    namespace views
+    {
+        struct segments_fn
+        {
+            template <std::ranges::viewable_range R>
+            auto operator()(R&& rng) const
+            {
+                return segments_view(std::forward<R>(rng));
+            }
+
+            template <std::ranges::viewable_range R>
+            friend auto operator|(R&& rng, const segments_fn& fn)
+            {
+                return fn(std::forward<R>(rng));
+            }
+        };
+
+        // data | ModernCpp::views::segments - range of std::span over contiguous blocks of data
+        inline constexpr segments_fn segments{};
+    } // namespace views
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // segmented algorithms - the inner loops run over contiguous spans
+    //
+    // Every segment is further split into fixed-size std::span<T, 64> blocks: loops with
+    // a compile-time trip count are vectorized even when the optimizer does not vectorize
+    // loops of unknown length (e.g. gcc -O2).
+
+    namespace detail
+    {
+        inline constexpr size_t segment_block_size = 64;
+
+        template <typename R, typename F>
+        void for_each_block(R&& rng, F&& f)
+        {
+            for (auto segment : views::segments(rng))
+            {
+                using T = typename decltype(segment)::element_type;
+
+                size_t i = 0;
+                for (; i + segment_block_size <= segment.size(); i += segment_block_size)
+                    f(std::span<T, segment_block_size>{segment.data() + i, segment_block_size});
+
+                f(segment.subspan(i));
+            }
+        }
+    } // namespace detail
+
+    template <std::ranges::viewable_range R, typename T>
+    void segmented_fill(R&& rng, const T& value)
+    {
+        detail::for_each_block(rng, [&](auto block) { std::fill(block.begin(), block.end(), value); });
+    }
+
+    template <std::ranges::viewable_range R, std::weakly_incrementable Out>
+    Out segmented_copy(R&& rng, Out out)
+    {
+        for (auto segment : views::segments(rng))
+            out = std::copy(segment.begin(), segment.end(), std::move(out));
+        return out;
+    }
+
+    template <std::ranges::viewable_range R, std::weakly_incrementable Out, typename F>
+    Out segmented_transform(R&& rng, Out out, F f)
+    {
+        for (auto segment : views::segments(rng))
+            out = std::transform(segment.begin(), segment.end(), std::move(out), std::ref(f));
+        return out;
+    }
+
+    // in-place version: item = f(item)
+    template <std::ranges::viewable_range R, typename F>
+    void segmented_transform(R&& rng, F f)
+    {
+        detail::for_each_block(rng, [&](auto block) { std::transform(block.begin(), block.end(), block.begin(), std::ref(f)); });
+    }
+
+    template <std::ranges::viewable_range R, typename T, typename BinaryOp = std::plus<>>
+    T segmented_accumulate(R&& rng, T init, BinaryOp op = {})
+    {
+        detail::for_each_block(rng, [&](auto block) { init = std::accumulate(block.begin(), block.end(), std::move(init), std::ref(op)); });
+        return init;
+    }
+} // namespace ModernCpp
+
+#endif
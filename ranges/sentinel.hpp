@@ -0,0 +1,214 @@
+#ifndef SENTINEL_HPP
+#define SENTINEL_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+template <auto Value>
+struct Sentinel
+{
+    bool operator==(auto it) const
+    {
+        return *it == Value;
+    }
+};
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // sentinel-aware algorithms - find/count/copy until Sentinel<Value>
+    //
+    // For contiguous ranges of 1, 2 or 4 byte integers the terminator is detected with
+    // SSE2 block scans (16 bytes at a time); otherwise the generic element-by-element loop is used.
+
+    namespace detail
+    {
+        // std::in_range that also accepts character types
+        template <std::integral T, std::integral U>
+        constexpr bool fits_in(U value) noexcept
+        {
+            return static_cast<U>(static_cast<T>(value)) == value && ((value < U{}) == (static_cast<T>(value) < T{}));
+        }
+
+        template <typename It, auto Value>
+        concept SimdScannable = std::contiguous_iterator<It>
+            && std::integral<std::iter_value_t<It>>
+            && (sizeof(std::iter_value_t<It>) == 1 || sizeof(std::iter_value_t<It>) == 2 || sizeof(std::iter_value_t<It>) == 4)
+            && std::integral<decltype(Value)>
+            && fits_in<std::iter_value_t<It>>(Value);
+
+#if defined(__SSE2__)
+        constexpr bool simd_enabled = true;
+        constexpr size_t block_size = 16;
+
+        // bit mask (one bit per byte) of lanes equal to value in the aligned block
+        //
+        // The block may extend past the terminator & past the end of the allocation, but an aligned
+        // block never crosses into another page (see scan_blocks) - such a load cannot fault, so
+        // AddressSanitizer is told not to report it.
+        template <typename T>
+        __attribute__((no_sanitize_address)) unsigned match_mask(const T* block, T value)
+        {
+            const __m128i data = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+
+            if constexpr (sizeof(T) == 1)
+                return _mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_set1_epi8(static_cast<char>(value))));
+            else if constexpr (sizeof(T) == 2)
+                return _mm_movemask_epi8(_mm_cmpeq_epi16(data, _mm_set1_epi16(static_cast<short>(value))));
+            else
+                return _mm_movemask_epi8(_mm_cmpeq_epi32(data, _mm_set1_epi32(static_cast<int>(value))));
+        }
+#else
+        constexpr bool simd_enabled = false;
+        constexpr size_t block_size = 16;
+#endif
+
+        template <typename T>
+        bool is_block_aligned(const T* ptr)
+        {
+            return reinterpret_cast<std::uintptr_t>(ptr) % block_size == 0;
+        }
+
+        // Scans memory in aligned blocks: an aligned load never crosses a page boundary,
+        // so reading lanes past the terminator (inside the same block) cannot fault.
+        // The same technique is used by strlen implementations.
+        template <typename T, typename OnBlock, typename OnTail>
+        const T* scan_blocks(const T* ptr, T terminator, OnBlock on_block, OnTail on_tail)
+        {
+            constexpr size_t lanes = block_size / sizeof(T);
+
+            for (;; ptr += lanes)
+            {
+                const unsigned terminator_mask = match_mask(ptr, terminator);
+
+                if (terminator_mask == 0)
+                {
+                    on_block(ptr);
+                    continue;
+                }
+
+                const size_t lane = std::countr_zero(terminator_mask) / sizeof(T);
+                on_tail(ptr, lane, terminator_mask);
+                return ptr + lane;
+            }
+        }
+    } // namespace detail
+
+    template <std::input_iterator It, auto Value>
+    It find(It first, Sentinel<Value> last)
+    {
+        if constexpr (detail::SimdScannable<It, Value> && detail::simd_enabled)
+        {
+            using T = std::iter_value_t<It>;
+            const T* const start = std::to_address(first);
+            const T* ptr = start;
+
+            for (; !detail::is_block_aligned(ptr); ++ptr)
+            {
+                if (*ptr == Value)
+                    return first + (ptr - start);
+            }
+
+            ptr = detail::scan_blocks(ptr, static_cast<T>(Value), [](const T*) { }, [](const T*, size_t, unsigned) { });
+
+            return first + (ptr - start);
+        }
+        else
+        {
+            while (first != last)
+                ++first;
+            return first;
+        }
+    }
+
+    template <std::input_iterator It, auto Value, typename T>
+    std::iter_difference_t<It> count(It first, Sentinel<Value> last, const T& value)
+    {
+        if constexpr (detail::SimdScannable<It, Value> && detail::simd_enabled && std::integral<T>)
+        {
+            using ValueT = std::iter_value_t<It>;
+            using CommonT = std::common_type_t<ValueT, T>;
+
+            // items are compared like *first == value - after the usual arithmetic conversions
+            // (an unsigned item equals -1 when it holds the maximum value); no item can be equal
+            // if value does not survive the round trip through ValueT
+            const ValueT needle = static_cast<ValueT>(value);
+            if (static_cast<CommonT>(needle) != static_cast<CommonT>(value))
+                return 0;
+
+            const ValueT* ptr = std::to_address(first);
+            std::iter_difference_t<It> counter = 0;
+
+            for (; !detail::is_block_aligned(ptr); ++ptr)
+            {
+                if (*ptr == Value)
+                    return counter;
+                counter += (*ptr == needle);
+            }
+
+            detail::scan_blocks(
+                ptr, static_cast<ValueT>(Value),
+                [&](const ValueT* block) {
+                    counter += std::popcount(detail::match_mask(block, needle)) / sizeof(ValueT);
+                },
+                [&](const ValueT* block, size_t, unsigned terminator_mask) {
+                    const unsigned before_terminator = (terminator_mask & (~terminator_mask + 1)) - 1;
+                    counter += std::popcount(detail::match_mask(block, needle) & before_terminator) / sizeof(ValueT);
+                });
+
+            return counter;
+        }
+        else
+        {
+            std::iter_difference_t<It> counter = 0;
+            for (; first != last; ++first)
+                counter += (*first == value);
+            return counter;
+        }
+    }
+
+    template <std::input_iterator It, auto Value, std::weakly_incrementable Out>
+        requires std::indirectly_copyable<It, Out>
+    std::ranges::copy_result<It, Out> copy(It first, Sentinel<Value> last, Out out)
+    {
+        if constexpr (detail::SimdScannable<It, Value> && detail::simd_enabled)
+        {
+            using T = std::iter_value_t<It>;
+            const T* const start = std::to_address(first);
+            const T* ptr = start;
+
+            for (; !detail::is_block_aligned(ptr) && *ptr != Value; ++ptr, ++out)
+                *out = *ptr;
+
+            if (detail::is_block_aligned(ptr))
+            {
+                constexpr size_t lanes = detail::block_size / sizeof(T);
+
+                ptr = detail::scan_blocks(
+                    ptr, static_cast<T>(Value),
+                    [&](const T* block) { out = std::ranges::copy_n(block, lanes, std::move(out)).out; },
+                    [&](const T* block, size_t lane, unsigned) { out = std::ranges::copy_n(block, lane, std::move(out)).out; });
+            }
+
+            return {first + (ptr - start), std::move(out)};
+        }
+        else
+        {
+            for (; first != last; ++first, ++out)
+                *out = *first;
+            return {std::move(first), std::move(out)};
+        }
+    }
+} // namespace ModernCpp
+
+#endif
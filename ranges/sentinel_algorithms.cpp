@@ -0,0 +1,230 @@
+#include "sentinel.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("sentinel algorithms - find", "[ranges][sentinels]")
+{
+    SECTION("NUL-terminated text")
+    {
+        std::string str = "Hello!!!\0fhgaksdjhgkasdjh"s;
+
+        auto pos = ModernCpp::find(str.begin(), Sentinel<'\0'>{});
+
+        REQUIRE(pos - str.begin() == 8);
+    }
+
+    SECTION("terminator at every offset & alignment")
+    {
+        for (size_t offset = 0; offset < 16; ++offset)
+        {
+            for (size_t length = 0; length < 100; ++length)
+            {
+                std::vector<char> buffer(offset + length + 32, 'a');
+                buffer[offset + length] = '\0';
+
+                auto pos = ModernCpp::find(buffer.begin() + offset, Sentinel<'\0'>{});
+
+                REQUIRE(static_cast<size_t>(pos - buffer.begin()) == offset + length);
+            }
+        }
+    }
+
+    SECTION("exact-size buffers - no padding after the terminator")
+    {
+        for (size_t offset = 0; offset < 16; ++offset)
+        {
+            for (size_t length = 0; length < 100; ++length)
+            {
+                std::vector<char> buffer(offset + length + 1, 'a');
+                buffer.back() = '\0';
+
+                auto pos = ModernCpp::find(buffer.begin() + offset, Sentinel<'\0'>{});
+
+                REQUIRE(pos == buffer.end() - 1);
+            }
+        }
+
+        std::unique_ptr<char[]> text{new char[4]{'a', 'b', 'c', '\0'}};
+        REQUIRE(ModernCpp::find(text.get(), Sentinel<'\0'>{}) == text.get() + 3);
+    }
+
+    SECTION("marker-terminated ints")
+    {
+        std::vector data = {2, 3, 4, 1, 5, 6, 7, 8, 9, 10, 11, 12, 13, 42, 6, 7};
+
+        auto pos = ModernCpp::find(data.begin(), Sentinel<42>{});
+
+        REQUIRE(*pos == 42);
+        REQUIRE(pos - data.begin() == 13);
+    }
+
+    SECTION("non-contiguous container uses generic path")
+    {
+        std::deque data = {2, 3, 4, 1, 5, 42, 6, 7};
+
+        auto pos = ModernCpp::find(data.begin(), Sentinel<42>{});
+
+        REQUIRE(pos - data.begin() == 5);
+    }
+}
+
+TEST_CASE("sentinel algorithms - count", "[ranges][sentinels]")
+{
+    SECTION("counts only items before terminator")
+    {
+        const char* text = "abracadabra, abracadabra, abracadabra, abracadabra\0aaaaaaaaaaaaaaaaaaaaaaaa";
+
+        auto result = ModernCpp::count(text, Sentinel<'\0'>{}, 'a');
+
+        REQUIRE(result == std::count(text, text + std::strlen(text), 'a'));
+    }
+
+    SECTION("every offset & alignment")
+    {
+        for (size_t offset = 0; offset < 16; ++offset)
+        {
+            for (size_t length = 0; length < 70; ++length)
+            {
+                std::vector<short> buffer(offset + length + 32, 7);
+                for (size_t i = 0; i < buffer.size(); i += 3)
+                    buffer[i] = 1;
+                buffer[offset + length] = -1;
+
+                auto first = buffer.begin() + offset;
+                auto result = ModernCpp::count(first, Sentinel<-1>{}, 1);
+
+                REQUIRE(result == std::count(first, first + length, short{1}));
+            }
+        }
+    }
+
+    SECTION("exact-size buffers - no padding after the terminator")
+    {
+        for (size_t offset = 0; offset < 16; ++offset)
+        {
+            for (size_t length = 0; length < 70; ++length)
+            {
+                std::vector<short> buffer(offset + length + 1, 1);
+                buffer.back() = -1;
+
+                REQUIRE(ModernCpp::count(buffer.begin() + offset, Sentinel<-1>{}, 1) == static_cast<std::ptrdiff_t>(length));
+            }
+        }
+    }
+
+    SECTION("value out of element range")
+    {
+        std::vector<unsigned char> buffer = {1, 255, 255, 0};
+
+        REQUIRE(ModernCpp::count(buffer.begin(), Sentinel<0>{}, -1) == 0);
+        REQUIRE(ModernCpp::count(buffer.begin(), Sentinel<0>{}, 255) == 2);
+    }
+
+    SECTION("mixed signedness - the same result as the generic path")
+    {
+        std::vector<unsigned> all_max(64, std::numeric_limits<unsigned>::max());
+        all_max.push_back(0);
+        const std::list<unsigned> all_max_list(all_max.begin(), all_max.end());
+
+        REQUIRE(ModernCpp::count(all_max.begin(), Sentinel<0>{}, -1) == 64);
+        REQUIRE(ModernCpp::count(all_max.begin(), Sentinel<0>{}, -1) == ModernCpp::count(all_max_list.begin(), Sentinel<0>{}, -1));
+
+        std::vector<int> minus_ones(40, -1);
+        minus_ones[3] = 5;
+        minus_ones.push_back(0);
+        const std::list<int> minus_ones_list(minus_ones.begin(), minus_ones.end());
+
+        for (auto value : {std::numeric_limits<unsigned>::max(), 5u})
+            REQUIRE(ModernCpp::count(minus_ones.begin(), Sentinel<0>{}, value) == ModernCpp::count(minus_ones_list.begin(), Sentinel<0>{}, value));
+
+        for (long long value : {-1LL, 4294967295LL})
+            REQUIRE(ModernCpp::count(minus_ones.begin(), Sentinel<0>{}, value) == ModernCpp::count(minus_ones_list.begin(), Sentinel<0>{}, value));
+
+        std::vector<unsigned char> bytes = {255, 1, 255, 0};
+        const std::list<unsigned char> bytes_list(bytes.begin(), bytes.end());
+        REQUIRE(ModernCpp::count(bytes.begin(), Sentinel<0>{}, -1) == ModernCpp::count(bytes_list.begin(), Sentinel<0>{}, -1));
+    }
+
+    SECTION("generic path")
+    {
+        std::deque data = {1, 2, 1, 1, 42, 1};
+
+        REQUIRE(ModernCpp::count(data.begin(), Sentinel<42>{}, 1) == 3);
+    }
+}
+
+TEST_CASE("sentinel algorithms - copy until", "[ranges][sentinels]")
+{
+    SECTION("copies without separate strlen pass")
+    {
+        std::string str = "Hello, this is a long enough text to span several blocks!\0garbage"s;
+        std::string target;
+
+        auto [in, out] = ModernCpp::copy(str.begin(), Sentinel<'\0'>{}, std::back_inserter(target));
+
+        REQUIRE(target == "Hello, this is a long enough text to span several blocks!");
+        REQUIRE(*in == '\0');
+    }
+
+    SECTION("every offset & alignment")
+    {
+        for (size_t offset = 0; offset < 8; ++offset)
+        {
+            for (size_t length = 0; length < 40; ++length)
+            {
+                std::vector<int> buffer(offset + length + 16);
+                std::iota(buffer.begin(), buffer.end(), 100);
+                buffer[offset + length] = 42;
+
+                std::vector<int> target(length + 1, -1);
+                auto [in, out] = ModernCpp::copy(buffer.begin() + offset, Sentinel<42>{}, target.begin());
+
+                REQUIRE(in - buffer.begin() == static_cast<std::ptrdiff_t>(offset + length));
+                REQUIRE(out - target.begin() == static_cast<std::ptrdiff_t>(length));
+                REQUIRE(std::equal(target.begin(), out, buffer.begin() + offset));
+                REQUIRE(target.back() == -1);
+            }
+        }
+    }
+
+    SECTION("exact-size buffers - no padding after the terminator")
+    {
+        for (size_t offset = 0; offset < 8; ++offset)
+        {
+            for (size_t length = 0; length < 40; ++length)
+            {
+                std::vector<int> buffer(offset + length + 1);
+                std::iota(buffer.begin(), buffer.end(), 100);
+                buffer.back() = 42;
+
+                std::vector<int> target;
+                auto [in, out] = ModernCpp::copy(buffer.begin() + offset, Sentinel<42>{}, std::back_inserter(target));
+
+                REQUIRE(in == buffer.end() - 1);
+                REQUIRE(std::equal(target.begin(), target.end(), buffer.begin() + offset, buffer.end() - 1));
+            }
+        }
+    }
+
+    SECTION("generic path")
+    {
+        std::deque data = {1, 2, 3, 42, 5};
+        std::vector<int> target;
+
+        ModernCpp::copy(data.begin(), Sentinel<42>{}, std::back_inserter(target));
+
+        REQUIRE(target == std::vector{1, 2, 3});
+    }
+}
@@ -0,0 +1,162 @@
+#include "soa_vector.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+static_assert(std::ranges::random_access_range<ModernCpp::soa_vector<int, double>>);
+static_assert(std::ranges::sized_range<ModernCpp::soa_vector<int, double>>);
+#ifdef __cpp_lib_ranges_zip // tuple<const Ts&...> proxies need common_reference support for tuples (P2321)
+static_assert(std::ranges::random_access_range<const ModernCpp::soa_vector<int, double>>);
+#endif
+
+TEST_CASE("soa_vector", "[ranges][soa]")
+{
+    ModernCpp::soa_vector<int, std::string> numbers;
+    numbers.push_back(1, "one");
+    numbers.push_back(2, "two");
+    numbers.push_back({3, "three"});
+
+    SECTION("zip-like iteration with proxy references")
+    {
+        for (auto [number, word] : numbers)
+        {
+            number *= 10;
+            word += "!";
+        }
+
+        REQUIRE(numbers[0] == std::tuple{10, "one!"s});
+        REQUIRE(numbers[2] == std::tuple{30, "three!"s});
+    }
+
+    SECTION("columns are contiguous spans")
+    {
+        std::span<int> ids = numbers.column<0>();
+        REQUIRE(ids.size() == 3);
+        REQUIRE(std::accumulate(ids.begin(), ids.end(), 0) == 6);
+
+        std::span<const std::string> words = std::as_const(numbers).column<1>();
+        REQUIRE(words[1] == "two");
+    }
+
+    SECTION("works with views")
+    {
+        auto words = numbers
+            | std::views::filter([](const auto& item) { return std::get<0>(item) % 2 == 1; })
+            | std::views::transform([](const auto& item) { return std::get<1>(item); });
+
+        REQUIRE(std::ranges::equal(words, std::vector{"one"s, "three"s}));
+        REQUIRE(std::ranges::equal(numbers | std::views::reverse | std::views::elements<0>, std::vector{3, 2, 1}));
+    }
+
+#ifdef __cpp_lib_ranges_zip
+    SECTION("std::views::zip over columns")
+    {
+        for (auto&& [number, word] : std::views::zip(numbers.column<0>(), numbers.column<1>()))
+            number += static_cast<int>(word.size());
+
+        REQUIRE(std::ranges::equal(numbers.column<0>(), std::vector{4, 5, 8}));
+    }
+#endif
+}
+
+namespace
+{
+    struct ThrowingOnCopy
+    {
+        int value;
+
+        explicit ThrowingOnCopy(int v)
+            : value{v}
+        {
+        }
+
+        ThrowingOnCopy(const ThrowingOnCopy& other)
+            : value{other.value}
+        {
+            if (value < 0)
+                throw std::runtime_error{"copy failed"};
+        }
+
+        ThrowingOnCopy& operator=(const ThrowingOnCopy&) = default;
+    };
+} // namespace
+
+TEST_CASE("soa_vector - push_back keeps columns in sync when a copy throws", "[ranges][soa]")
+{
+    ModernCpp::soa_vector<int, std::string, ThrowingOnCopy> items;
+    items.push_back(1, "one", ThrowingOnCopy{1});
+
+    REQUIRE_THROWS_AS(items.push_back(2, "two", ThrowingOnCopy{-1}), std::runtime_error);
+
+    REQUIRE(items.size() == 1);
+    REQUIRE(items.column<0>().size() == 1);
+    REQUIRE(items.column<1>().size() == 1);
+    REQUIRE(items.column<2>().size() == 1);
+    REQUIRE(std::get<1>(items[0]) == "one");
+
+    items.push_back(3, "three", ThrowingOnCopy{3});
+    REQUIRE(items.size() == 2);
+    REQUIRE(std::get<2>(items[1]).value == 3);
+}
+
+namespace
+{
+    struct Particle
+    {
+        float x, y, z;
+        float vx, vy, vz;
+        double mass;
+        int id;
+    };
+
+    using Particles = ModernCpp::soa_vector<float, float, float, float, float, float, double, int>;
+
+    constexpr size_t particle_count = 1'000'000;
+
+    void move_x(std::span<float> x, std::span<const float> vx, float dt)
+    {
+        for (size_t i = 0; i < x.size(); ++i)
+            x[i] += vx[i] * dt;
+    }
+} // namespace
+
+TEST_CASE("soa_vector vs vector of structs", "[ranges][soa][.benchmark]")
+{
+    std::vector<Particle> aos(particle_count, Particle{1.0f, 2.0f, 3.0f, 0.5f, 0.5f, 0.5f, 1.0, 0});
+
+    Particles soa;
+    soa.reserve(particle_count);
+    for (const auto& p : aos)
+        soa.push_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.id);
+
+    constexpr float dt = 0.01f;
+
+    BENCHMARK("AoS - update x")
+    {
+        for (auto& p : aos)
+            p.x += p.vx * dt;
+        return aos.front().x;
+    };
+
+    BENCHMARK("SoA - update x over column spans")
+    {
+        move_x(soa.column<0>(), soa.column<3>(), dt);
+        return soa.column<0>().front();
+    };
+
+    BENCHMARK("SoA - update x through proxy references")
+    {
+        for (auto&& item : soa)
+            std::get<0>(item) += std::get<3>(item) * dt;
+        return soa.column<0>().front();
+    };
+}
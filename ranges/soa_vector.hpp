@@ -0,0 +1,246 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // soa_vector<Ts...> - structure of arrays: one contiguous std::vector per field
+    //
+    // Iteration zips the columns and yields proxy references (std::tuple<Ts&...>),
+    // column<I>() exposes a single field as std::span - loops over one field touch only
+    // the cache lines of that field and are easily auto-vectorized.
+    template <typename... Ts>
+        requires(sizeof...(Ts) > 0)
+    class soa_vector
+    {
+        std::tuple<std::vector<Ts>...> columns_;
+
+        template <typename F>
+        void for_each_column(F&& f)
+        {
+            std::apply([&](auto&... column) { (f(column), ...); }, columns_);
+        }
+
+    public:
+        using value_type = std::tuple<Ts...>;
+        using reference = std::tuple<Ts&...>;
+        using const_reference = std::tuple<const Ts&...>;
+
+        template <size_t I>
+        using column_type = std::tuple_element_t<I, value_type>;
+
+        template <bool IsConst>
+        class basic_iterator
+        {
+            using soa_type = std::conditional_t<IsConst, const soa_vector, soa_vector>;
+
+            soa_type* soa_ = nullptr;
+            std::ptrdiff_t index_ = 0;
+
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag; // operator* returns a proxy
+            using value_type = soa_vector::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<IsConst, soa_vector::const_reference, soa_vector::reference>;
+
+            basic_iterator() = default;
+
+            basic_iterator(soa_type* soa, std::ptrdiff_t index)
+                : soa_{soa}
+                , index_{index}
+            { }
+
+            reference operator*() const
+            {
+                return (*soa_)[static_cast<size_t>(index_)];
+            }
+
+            reference operator[](difference_type n) const
+            {
+                return (*soa_)[static_cast<size_t>(index_ + n)];
+            }
+
+            basic_iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            basic_iterator operator++(int)
+            {
+                auto tmp = *this;
+                ++index_;
+                return tmp;
+            }
+
+            basic_iterator& operator--()
+            {
+                --index_;
+                return *this;
+            }
+
+            basic_iterator operator--(int)
+            {
+                auto tmp = *this;
+                --index_;
+                return tmp;
+            }
+
+            basic_iterator& operator+=(difference_type n)
+            {
+                index_ += n;
+                return *this;
+            }
+
+            basic_iterator& operator-=(difference_type n)
+            {
+                index_ -= n;
+                return *this;
+            }
+
+            friend basic_iterator operator+(basic_iterator it, difference_type n)
+            {
+                return it += n;
+            }
+
+            friend basic_iterator operator+(difference_type n, basic_iterator it)
+            {
+                return it += n;
+            }
+
+            friend basic_iterator operator-(basic_iterator it, difference_type n)
+            {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs)
+            {
+                return lhs.index_ - rhs.index_;
+            }
+
+            bool operator==(const basic_iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+
+            auto operator<=>(const basic_iterator& other) const
+            {
+                return index_ <=> other.index_;
+            }
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        soa_vector() = default;
+
+        explicit soa_vector(size_t size)
+        {
+            resize(size);
+        }
+
+        size_t size() const noexcept
+        {
+            return std::get<0>(columns_).size();
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        void reserve(size_t capacity)
+        {
+            for_each_column([capacity](auto& column) { column.reserve(capacity); });
+        }
+
+        void resize(size_t size)
+        {
+            for_each_column([size](auto& column) { column.resize(size); });
+        }
+
+        void clear() noexcept
+        {
+            for_each_column([](auto& column) { column.clear(); });
+        }
+
+        // strong guarantee - if a column throws, the columns already grown are shrunk back
+        void push_back(const Ts&... values)
+        {
+            size_t pushed = 0;
+
+            try
+            {
+                [&]<size_t... Is>(std::index_sequence<Is...>) {
+                    ((std::get<Is>(columns_).push_back(values), ++pushed), ...);
+                }(std::index_sequence_for<Ts...>{});
+            }
+            catch (...)
+            {
+                [&]<size_t... Is>(std::index_sequence<Is...>) {
+                    ((Is < pushed ? std::get<Is>(columns_).pop_back() : void()), ...);
+                }(std::index_sequence_for<Ts...>{});
+                throw;
+            }
+        }
+
+        void push_back(const value_type& item)
+        {
+            std::apply([this](const auto&... values) { push_back(values...); }, item);
+        }
+
+        reference operator[](size_t index) noexcept
+        {
+            return std::apply([index](auto&... column) { return reference{column[index]...}; }, columns_);
+        }
+
+        const_reference operator[](size_t index) const noexcept
+        {
+            return std::apply([index](const auto&... column) { return const_reference{column[index]...}; }, columns_);
+        }
+
+        template <size_t I>
+        std::span<column_type<I>> column() noexcept
+        {
+            return std::get<I>(columns_);
+        }
+
+        template <size_t I>
+        std::span<const column_type<I>> column() const noexcept
+        {
+            return std::get<I>(columns_);
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator{this, 0};
+        }
+
+        iterator end() noexcept
+        {
+            return iterator{this, static_cast<std::ptrdiff_t>(size())};
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator{this, 0};
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator{this, static_cast<std::ptrdiff_t>(size())};
+        }
+    };
+} // namespace ModernCpp
+
+#endif
@@ -0,0 +1,130 @@
+#include "byte_serialization.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <vector>
+
+namespace
+{
+    enum class Format : std::uint16_t
+    {
+        raw = 1,
+        compressed = 2
+    };
+
+    struct SnapshotHeader
+    {
+        std::uint32_t version;
+        Format format;
+        double timestamp;
+    };
+
+    struct Sample
+    {
+        float x, y, z;
+        std::int32_t id;
+    };
+
+    // storage aligned for every stored type - as vector<std::byte> from operator new or a mmapped file
+    struct alignas(16) Block
+    {
+        std::byte bytes[16];
+    };
+
+    std::span<std::byte> as_byte_buffer(std::vector<Block>& blocks)
+    {
+        return std::as_writable_bytes(std::span{blocks});
+    }
+} // namespace
+
+TEST_CASE("byte serialization")
+{
+    std::vector<Block> storage(64);
+    ModernCpp::byte_writer writer{as_byte_buffer(storage)};
+
+    SECTION("scalars are little-endian on the wire")
+    {
+        writer.write(std::uint32_t{0x01020304});
+
+        auto bytes = writer.written();
+        REQUIRE(bytes.size() == 4);
+        REQUIRE(bytes[0] == std::byte{0x04});
+        REQUIRE(bytes[3] == std::byte{0x01});
+    }
+
+    SECTION("round trip")
+    {
+        const std::vector<Sample> samples = {{1.0f, 2.0f, 3.0f, 1}, {4.0f, 5.0f, 6.0f, 2}, {7.0f, 8.0f, 9.0f, 3}};
+
+        writer.write(SnapshotHeader{3, Format::raw, std::numbers::pi});
+        writer.write(std::uint8_t{42}); // breaks alignment of the following array
+        writer.write_array(samples);
+        writer.write_array(std::vector<double>{0.5, 1.5});
+
+        ModernCpp::byte_reader reader{writer.written()};
+
+        auto header = reader.read<SnapshotHeader>();
+        REQUIRE(header.version == 3);
+        REQUIRE(header.format == Format::raw);
+        REQUIRE(header.timestamp == std::numbers::pi);
+
+        REQUIRE(reader.read<std::uint8_t>() == 42);
+
+        std::span<const Sample> samples_view = reader.view_array<Sample>();
+        REQUIRE(samples_view.size() == 3);
+        REQUIRE(samples_view[2].z == 9.0f);
+        REQUIRE(samples_view[2].id == 3);
+
+        // zero-copy - the view points into the buffer
+        auto buffer = writer.written();
+        REQUIRE(reinterpret_cast<const std::byte*>(samples_view.data()) >= buffer.data());
+        REQUIRE(reinterpret_cast<const std::byte*>(samples_view.data()) < buffer.data() + buffer.size());
+
+        std::span<const double> doubles = reader.view_array<double>();
+        REQUIRE(doubles.size() == 2);
+        REQUIRE(doubles[1] == 1.5);
+
+        REQUIRE(reader.remaining().empty());
+    }
+
+    SECTION("buffer too small")
+    {
+        std::vector<double> data(1000);
+        REQUIRE_THROWS_AS(writer.write_array(data), std::length_error);
+    }
+
+    SECTION("read past the end")
+    {
+        writer.write(std::uint16_t{1});
+
+        ModernCpp::byte_reader reader{writer.written()};
+        REQUIRE_THROWS_AS(reader.read<std::uint32_t>(), std::out_of_range);
+    }
+
+    SECTION("corrupted count")
+    {
+        writer.write(std::uint64_t{1'000'000'000'000});
+
+        ModernCpp::byte_reader reader{writer.written()};
+        REQUIRE_THROWS_AS(reader.view_array<double>(), std::out_of_range);
+        REQUIRE(reader.bytes_read() == 0);
+    }
+
+    SECTION("misaligned buffers")
+    {
+        ModernCpp::byte_writer misaligned_writer{as_byte_buffer(storage).subspan(1)};
+        REQUIRE_THROWS_AS(misaligned_writer.write_array(std::vector<int>{1, 2, 3}), std::invalid_argument);
+
+        writer.write_array(std::vector<int>{1, 2, 3});
+        std::vector<Block> copy(64);
+        std::span<std::byte> shifted = as_byte_buffer(copy).subspan(2);
+        std::ranges::copy(writer.written(), shifted.begin());
+
+        ModernCpp::byte_reader misaligned_reader{shifted.first(writer.bytes_written())};
+        REQUIRE_THROWS_AS(misaligned_reader.view_array<int>(), std::invalid_argument);
+        REQUIRE(misaligned_reader.bytes_read() == 0);
+        REQUIRE(misaligned_reader.read<std::uint64_t>() == 3);
+    }
+}
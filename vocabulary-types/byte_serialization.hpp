@@ -0,0 +1,235 @@
+#ifndef BYTE_SERIALIZATION_HPP
+#define BYTE_SERIALIZATION_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // zero-copy binary serialization over std::span<std::byte>
+    //
+    //   byte_writer writer{std::as_writable_bytes(std::span{buffer})};
+    //   writer.write(header);
+    //   writer.write_array(std::span{samples});          // count + padding + raw bytes of samples
+    //
+    //   byte_reader reader{file_bytes};                   // e.g. mmapped snapshot
+    //   auto h = reader.read<Header>();
+    //   std::span<const Sample> s = reader.view_array<Sample>();   // no copy - points into file_bytes
+    //
+    // Wire format is little-endian. Scalars (arithmetic types & enums) are byte-swapped on big-endian
+    // hosts; structs and views of arrays are raw object representations, so they require a little-endian host.
+    // Arrays are padded to alignof(T) relative to the start of the buffer - buffers of the writer and
+    // the reader must be aligned at least as strictly as the stored types.
+
+    template <typename T>
+    concept ByteSerializable = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !std::is_member_pointer_v<T>;
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr bool is_scalar_value_v = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+        template <ByteSerializable T>
+        constexpr bool is_wire_compatible_v = std::endian::native == std::endian::little || sizeof(T) == 1 || is_scalar_value_v<T>;
+
+        template <typename T>
+        T byteswap_value(T value) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+                return value;
+            else
+            {
+                auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+                std::ranges::reverse(bytes);
+                return std::bit_cast<T>(bytes);
+            }
+        }
+
+        // native <-> little-endian for scalars, identity for everything else
+        template <typename T>
+        T to_wire(T value) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::big && is_scalar_value_v<T>)
+                return byteswap_value(value);
+            else
+                return value;
+        }
+
+        inline bool is_aligned(const void* ptr, size_t alignment) noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+        }
+
+        inline size_t align_up(size_t offset, size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+    } // namespace detail
+
+    class byte_writer
+    {
+        std::span<std::byte> buffer_;
+        size_t offset_ = 0;
+
+        std::byte* reserve(size_t size)
+        {
+            if (size > buffer_.size() - offset_)
+                throw std::length_error("byte_writer - buffer is too small");
+
+            return buffer_.data() + std::exchange(offset_, offset_ + size);
+        }
+
+    public:
+        explicit byte_writer(std::span<std::byte> buffer) noexcept
+            : buffer_{buffer}
+        { }
+
+        template <ByteSerializable T>
+        void write(const T& value)
+        {
+            static_assert(detail::is_wire_compatible_v<T>, "structs are stored as raw bytes - a little-endian host is required");
+
+            const T wire_value = detail::to_wire(value);
+            std::memcpy(reserve(sizeof(T)), &wire_value, sizeof(T));
+        }
+
+        // zero bytes up to the next multiple of alignment (relative to the start of the buffer)
+        void align_to(size_t alignment)
+        {
+            const size_t padding = detail::align_up(offset_, alignment) - offset_;
+            std::memset(reserve(padding), 0, padding);
+        }
+
+        // element count (uint64) + padding to alignof(T) + elements
+        template <ByteSerializable T>
+        void write_array(std::span<const T> items)
+        {
+            static_assert(detail::is_wire_compatible_v<T>, "structs are stored as raw bytes - a little-endian host is required");
+
+            if (!detail::is_aligned(buffer_.data(), alignof(T)))
+                throw std::invalid_argument("byte_writer - buffer is not aligned for the stored type");
+
+            write(static_cast<std::uint64_t>(items.size()));
+            align_to(alignof(T));
+
+            std::byte* dest = reserve(items.size_bytes());
+
+            if constexpr (std::endian::native == std::endian::little || sizeof(T) == 1)
+            {
+                if (!items.empty())
+                    std::memcpy(dest, items.data(), items.size_bytes());
+            }
+            else
+            {
+                for (const T& item : items)
+                {
+                    const T wire_value = detail::to_wire(item);
+                    std::memcpy(dest, &wire_value, sizeof(T));
+                    dest += sizeof(T);
+                }
+            }
+        }
+
+        template <typename R>
+            requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+        void write_array(R&& items)
+        {
+            write_array(std::span<const std::ranges::range_value_t<R>>{std::ranges::data(items), std::ranges::size(items)});
+        }
+
+        size_t bytes_written() const noexcept
+        {
+            return offset_;
+        }
+
+        std::span<std::byte> written() const noexcept
+        {
+            return buffer_.first(offset_);
+        }
+    };
+
+    class byte_reader
+    {
+        std::span<const std::byte> buffer_;
+        size_t offset_ = 0;
+
+        const std::byte* consume(size_t size)
+        {
+            if (size > buffer_.size() - offset_)
+                throw std::out_of_range("byte_reader - read past the end of the buffer");
+
+            return buffer_.data() + std::exchange(offset_, offset_ + size);
+        }
+
+    public:
+        explicit byte_reader(std::span<const std::byte> buffer) noexcept
+            : buffer_{buffer}
+        { }
+
+        // copies the value - works for any alignment
+        template <ByteSerializable T>
+        T read()
+        {
+            static_assert(detail::is_wire_compatible_v<T>, "structs are stored as raw bytes - a little-endian host is required");
+
+            T value;
+            std::memcpy(&value, consume(sizeof(T)), sizeof(T));
+            return detail::to_wire(value);
+        }
+
+        void align_to(size_t alignment)
+        {
+            consume(detail::align_up(offset_, alignment) - offset_);
+        }
+
+        // view of an array stored by byte_writer::write_array - no copy
+        template <ByteSerializable T>
+        std::span<const T> view_array()
+        {
+            static_assert(std::endian::native == std::endian::little || sizeof(T) == 1, "zero-copy views require a little-endian host");
+
+            // the header is parsed with a copy - the position is updated only for a valid array
+            byte_reader cursor = *this;
+            const auto count = cursor.read<std::uint64_t>();
+            cursor.align_to(alignof(T));
+
+            if (count > (buffer_.size() - cursor.offset_) / sizeof(T))
+                throw std::out_of_range("byte_reader - read past the end of the buffer");
+
+            if (!detail::is_aligned(buffer_.data() + cursor.offset_, alignof(T)))
+                throw std::invalid_argument("byte_reader - array is misaligned in the buffer");
+
+            const std::byte* data = cursor.consume(static_cast<size_t>(count) * sizeof(T));
+            offset_ = cursor.offset_;
+
+#ifdef __cpp_lib_start_lifetime_as
+            return std::span<const T>{std::start_lifetime_as_array<const T>(data, static_cast<size_t>(count)), static_cast<size_t>(count)};
+#else
+            return std::span<const T>{reinterpret_cast<const T*>(data), static_cast<size_t>(count)};
+#endif
+        }
+
+        size_t bytes_read() const noexcept
+        {
+            return offset_;
+        }
+
+        std::span<const std::byte> remaining() const noexcept
+        {
+            return buffer_.subspan(offset_);
+        }
+    };
+} // namespace ModernCpp
+
+#endif
@@ -0,0 +1,155 @@
+#include "hex.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <numeric>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    std::span<const std::byte> bytes_of(std::string_view text)
+    {
+        return std::as_bytes(std::span{text});
+    }
+
+    std::vector<std::byte> all_byte_values(size_t size)
+    {
+        std::vector<std::byte> data(size);
+        for (size_t i = 0; i < size; ++i)
+            data[i] = static_cast<std::byte>(i * 7 + 3);
+        return data;
+    }
+} // namespace
+
+TEST_CASE("hex encode")
+{
+    SECTION("lower & upper case")
+    {
+        const std::byte data[] = {std::byte{0x00}, std::byte{0x9F}, std::byte{0xA0}, std::byte{0xFF}};
+
+        REQUIRE(ModernCpp::to_hex(data) == "009fa0ff");
+        REQUIRE(ModernCpp::to_hex(data, ModernCpp::hex_case::upper) == "009FA0FF");
+    }
+
+    SECTION("SIMD blocks & scalar tail match the lookup table")
+    {
+        for (size_t size : {15u, 16u, 33u, 256u, 1000u})
+        {
+            auto data = all_byte_values(size);
+
+            std::string expected;
+            for (std::byte b : data)
+            {
+                char chars[3];
+                std::snprintf(chars, sizeof(chars), "%02x", std::to_integer<unsigned>(b));
+                expected += chars;
+            }
+
+            REQUIRE(ModernCpp::to_hex(data) == expected);
+        }
+    }
+
+    SECTION("output buffer too small")
+    {
+        char out[3];
+        REQUIRE_THROWS_AS(ModernCpp::hex_encode(bytes_of("ab"), out), std::length_error);
+    }
+}
+
+TEST_CASE("hex decode")
+{
+    SECTION("round trip")
+    {
+        for (size_t size : {0u, 1u, 16u, 17u, 1000u})
+        {
+            auto data = all_byte_values(size);
+
+            std::vector<std::byte> decoded(size);
+            REQUIRE(ModernCpp::hex_decode(ModernCpp::to_hex(data, ModernCpp::hex_case::upper), decoded) == size);
+            REQUIRE(decoded == data);
+        }
+    }
+
+    SECTION("mixed case")
+    {
+        std::byte out[2];
+        ModernCpp::hex_decode("aB9f", out);
+        REQUIRE(out[0] == std::byte{0xAB});
+        REQUIRE(out[1] == std::byte{0x9F});
+    }
+
+    SECTION("invalid input")
+    {
+        std::vector<std::byte> out(64);
+
+        REQUIRE_THROWS_AS(ModernCpp::hex_decode("abc", out), std::invalid_argument);
+        REQUIRE_THROWS_AS(ModernCpp::hex_decode("0g", out), std::invalid_argument);
+
+        // invalid characters inside a SIMD block
+        std::string text(64, '0');
+        for (char c : {'g', 'G', '/', ':', '@', '`', '\x80', '\xFF'})
+        {
+            text[20] = c;
+            REQUIRE_THROWS_AS(ModernCpp::hex_decode(text, out), std::invalid_argument);
+        }
+    }
+}
+
+TEST_CASE("hex dump")
+{
+    const auto text = "#include <catch2/catch_test_macros.hpp>\n"sv;
+
+    const auto expected =
+        "00000000: 2369 6e63 6c75 6465 203c 6361 7463 6832  #include <catch2\n"
+        "00000010: 2f63 6174 6368 5f74 6573 745f 6d61 6372  /catch_test_macr\n"
+        "00000020: 6f73 2e68 7070 3e0a                      os.hpp>.\n"sv;
+
+    REQUIRE(ModernCpp::hex_dump_size(text.size()) == expected.size());
+    REQUIRE(ModernCpp::to_hex_dump(bytes_of(text)) == expected);
+
+    SECTION("start offset")
+    {
+        auto dump = ModernCpp::to_hex_dump(bytes_of("ab"), 0x1234'5678);
+        REQUIRE(dump == "12345678: 6162                                     ab\n");
+    }
+
+    SECTION("caller buffer")
+    {
+        std::array<char, 128> buffer;
+        size_t written = ModernCpp::hex_dump(bytes_of(text.substr(0, 16)), buffer);
+        REQUIRE(std::string_view(buffer.data(), written) == expected.substr(0, 68));
+
+        REQUIRE_THROWS_AS(ModernCpp::hex_dump(bytes_of(text), buffer), std::length_error);
+    }
+}
+
+TEST_CASE("hex encode - benchmark", "[.benchmark]")
+{
+    const auto data = all_byte_values(1 << 20);
+    std::string out(ModernCpp::hex_encoded_size(data.size()), '\0');
+
+    BENCHMARK("snprintf per byte")
+    {
+        for (size_t i = 0; i < data.size(); ++i)
+            std::snprintf(out.data() + 2 * i, 3, "%02x", std::to_integer<unsigned>(data[i]));
+        return out.back();
+    };
+
+    BENCHMARK("ModernCpp::hex_encode")
+    {
+        ModernCpp::hex_encode(data, out);
+        return out.back();
+    };
+
+    BENCHMARK("ModernCpp::hex_decode")
+    {
+        std::vector<std::byte> decoded(data.size());
+        return ModernCpp::hex_decode(out, decoded);
+    };
+}
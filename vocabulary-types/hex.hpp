@@ -0,0 +1,297 @@
+#ifndef HEX_HPP
+#define HEX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // hex encoding, decoding & xxd-style dumps of byte buffers
+    //
+    // hex_encode, hex_decode & hex_dump write into a caller-provided buffer and never allocate.
+    // With SSE2 16 bytes are processed per step: nibbles are split with shifts & masks
+    // and mapped to ASCII with a compare-and-add, without table lookups.
+
+    enum class hex_case
+    {
+        lower,
+        upper
+    };
+
+    namespace detail
+    {
+        inline constexpr std::string_view hex_digits_lower = "0123456789abcdef";
+        inline constexpr std::string_view hex_digits_upper = "0123456789ABCDEF";
+
+        // two chars for every byte value
+        constexpr std::array<char, 512> make_hex_table(std::string_view digits)
+        {
+            std::array<char, 512> table{};
+            for (size_t i = 0; i < 256; ++i)
+            {
+                table[2 * i] = digits[i >> 4];
+                table[2 * i + 1] = digits[i & 0x0F];
+            }
+            return table;
+        }
+
+        inline constexpr std::array<char, 512> hex_table_lower = make_hex_table(hex_digits_lower);
+        inline constexpr std::array<char, 512> hex_table_upper = make_hex_table(hex_digits_upper);
+
+        inline constexpr std::uint8_t invalid_nibble = 0xFF;
+
+        constexpr std::array<std::uint8_t, 256> make_nibble_table()
+        {
+            std::array<std::uint8_t, 256> table{};
+            table.fill(invalid_nibble);
+            for (std::uint8_t i = 0; i < 10; ++i)
+                table['0' + i] = i;
+            for (std::uint8_t i = 0; i < 6; ++i)
+            {
+                table['a' + i] = 10 + i;
+                table['A' + i] = 10 + i;
+            }
+            return table;
+        }
+
+        inline constexpr std::array<std::uint8_t, 256> nibble_table = make_nibble_table();
+
+        inline void encode_scalar(const std::byte* in, size_t size, char* out, hex_case letter_case) noexcept
+        {
+            const char* table = (letter_case == hex_case::lower ? hex_table_lower : hex_table_upper).data();
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                const char* chars = table + 2 * std::to_integer<size_t>(in[i]);
+                out[2 * i] = chars[0];
+                out[2 * i + 1] = chars[1];
+            }
+        }
+
+        // returns false for an invalid character
+        inline bool decode_scalar(const char* in, size_t size, std::byte* out) noexcept
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                const std::uint8_t hi = nibble_table[static_cast<unsigned char>(in[2 * i])];
+                const std::uint8_t lo = nibble_table[static_cast<unsigned char>(in[2 * i + 1])];
+
+                if ((hi | lo) == invalid_nibble)
+                    return false;
+
+                out[i] = static_cast<std::byte>((hi << 4) | lo);
+            }
+            return true;
+        }
+
+#if defined(__SSE2__)
+        // 16 nibbles (0..15) -> 16 ASCII hex digits
+        inline __m128i nibbles_to_ascii(__m128i nibbles, __m128i letter_offset) noexcept
+        {
+            const __m128i is_letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+            return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), _mm_and_si128(is_letter, letter_offset));
+        }
+
+        // returns number of bytes encoded (a multiple of 16)
+        inline size_t encode_sse2(const std::byte* in, size_t size, char* out, hex_case letter_case) noexcept
+        {
+            const __m128i letter_offset = _mm_set1_epi8(letter_case == hex_case::lower ? 'a' - '0' - 10 : 'A' - '0' - 10);
+            const __m128i low_mask = _mm_set1_epi8(0x0F);
+
+            size_t i = 0;
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), low_mask);
+                const __m128i lo = _mm_and_si128(bytes, low_mask);
+
+                // hi nibble of every byte goes first
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), nibbles_to_ascii(_mm_unpacklo_epi8(hi, lo), letter_offset));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), nibbles_to_ascii(_mm_unpackhi_epi8(hi, lo), letter_offset));
+            }
+            return i;
+        }
+
+        // 16 ASCII hex digits -> 16 nibbles; valid_mask gets a movemask of valid characters
+        inline __m128i ascii_to_nibbles(__m128i chars, int& valid_mask) noexcept
+        {
+            const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+
+            // chars >= 0x80 are negative in signed compares - never valid
+            const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+            const __m128i is_letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+            valid_mask = _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter));
+
+            const __m128i digit_values = _mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0')));
+            const __m128i letter_values = _mm_and_si128(is_letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+            return _mm_or_si128(digit_values, letter_values);
+        }
+
+        // 16 nibbles (hi, lo, hi, lo, ...) -> 8 bytes in the low 16-bit lanes
+        inline __m128i combine_nibbles(__m128i nibbles) noexcept
+        {
+            const __m128i hi = _mm_and_si128(nibbles, _mm_set1_epi16(0x00FF));
+            const __m128i lo = _mm_srli_epi16(nibbles, 8);
+            return _mm_or_si128(_mm_slli_epi16(hi, 4), lo);
+        }
+
+        // returns number of bytes decoded (a multiple of 16) - stops before the first block with an invalid character
+        inline size_t decode_sse2(const char* in, size_t size, std::byte* out) noexcept
+        {
+            size_t i = 0;
+            for (; i + 16 <= size; i += 16)
+            {
+                int valid_first, valid_second;
+                const __m128i first = ascii_to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i)), valid_first);
+                const __m128i second = ascii_to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i + 16)), valid_second);
+
+                if ((valid_first & valid_second) != 0xFFFF)
+                    break;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(combine_nibbles(first), combine_nibbles(second)));
+            }
+            return i;
+        }
+#endif
+    } // namespace detail
+
+    constexpr size_t hex_encoded_size(size_t bytes) noexcept
+    {
+        return 2 * bytes;
+    }
+
+    // writes 2 * in.size() chars to out; returns number of chars written
+    inline size_t hex_encode(std::span<const std::byte> in, std::span<char> out, hex_case letter_case = hex_case::lower)
+    {
+        if (out.size() < hex_encoded_size(in.size()))
+            throw std::length_error("hex_encode - output buffer is too small");
+
+        size_t done = 0;
+#if defined(__SSE2__)
+        done = detail::encode_sse2(in.data(), in.size(), out.data(), letter_case);
+#endif
+        detail::encode_scalar(in.data() + done, in.size() - done, out.data() + 2 * done, letter_case);
+
+        return hex_encoded_size(in.size());
+    }
+
+    inline std::string to_hex(std::span<const std::byte> in, hex_case letter_case = hex_case::lower)
+    {
+        std::string result(hex_encoded_size(in.size()), '\0');
+        hex_encode(in, result, letter_case);
+        return result;
+    }
+
+    // accepts upper & lower case digits; returns number of bytes written
+    inline size_t hex_decode(std::string_view in, std::span<std::byte> out)
+    {
+        if (in.size() % 2 != 0)
+            throw std::invalid_argument("hex_decode - odd number of hex digits");
+
+        const size_t size = in.size() / 2;
+        if (out.size() < size)
+            throw std::length_error("hex_decode - output buffer is too small");
+
+        size_t done = 0;
+#if defined(__SSE2__)
+        done = detail::decode_sse2(in.data(), size, out.data());
+#endif
+        if (!detail::decode_scalar(in.data() + 2 * done, size - done, out.data() + done))
+            throw std::invalid_argument("hex_decode - invalid hex digit");
+
+        return size;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // xxd-style dump:
+    // 00000000: 2369 6e63 6c75 6465 203c 6361 7463 6832  #include <catch2
+
+    namespace detail
+    {
+        inline constexpr size_t dump_bytes_per_line = 16;
+        inline constexpr size_t dump_offset_width = 10;                         // "00000000: "
+        inline constexpr size_t dump_hex_width = 2 * dump_bytes_per_line + 7;    // 8 groups of 4 digits + 7 spaces
+        inline constexpr size_t dump_line_width = dump_offset_width + dump_hex_width + 2 + dump_bytes_per_line + 1;
+    } // namespace detail
+
+    // buffer size required by hex_dump for bytes bytes
+    constexpr size_t hex_dump_size(size_t bytes) noexcept
+    {
+        const size_t full_lines = bytes / detail::dump_bytes_per_line;
+        const size_t tail = bytes % detail::dump_bytes_per_line;
+
+        return full_lines * detail::dump_line_width
+            + (tail ? detail::dump_offset_width + detail::dump_hex_width + 2 + tail + 1 : 0);
+    }
+
+    // returns number of chars written; start_offset is the offset printed for the first byte
+    inline size_t hex_dump(std::span<const std::byte> in, std::span<char> out, size_t start_offset = 0)
+    {
+        if (out.size() < hex_dump_size(in.size()))
+            throw std::length_error("hex_dump - output buffer is too small");
+
+        char* dest = out.data();
+
+        for (size_t line_start = 0; line_start < in.size(); line_start += detail::dump_bytes_per_line)
+        {
+            const auto line = in.subspan(line_start, std::min(detail::dump_bytes_per_line, in.size() - line_start));
+
+            // offset - 8 hex digits, big-endian
+            const auto offset = static_cast<std::uint32_t>(start_offset + line_start);
+            const std::byte offset_bytes[] = {std::byte(offset >> 24), std::byte(offset >> 16), std::byte(offset >> 8), std::byte(offset)};
+            detail::encode_scalar(offset_bytes, 4, dest, hex_case::lower);
+            dest[8] = ':';
+            dest[9] = ' ';
+            dest += detail::dump_offset_width;
+
+            std::array<char, 2 * detail::dump_bytes_per_line> digits;
+            hex_encode(line, digits);
+
+            const size_t digit_count = 2 * line.size();
+            for (size_t group = 0; group < 8; ++group)
+            {
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    const size_t index = 4 * group + k;
+                    *dest++ = index < digit_count ? digits[index] : ' ';
+                }
+                if (group != 7)
+                    *dest++ = ' ';
+            }
+
+            *dest++ = ' ';
+            *dest++ = ' ';
+
+            for (std::byte b : line)
+            {
+                const auto c = std::to_integer<unsigned char>(b);
+                *dest++ = (c >= 0x20 && c < 0x7F) ? static_cast<char>(c) : '.';
+            }
+
+            *dest++ = '\n';
+        }
+
+        return static_cast<size_t>(dest - out.data());
+    }
+
+    inline std::string to_hex_dump(std::span<const std::byte> in, size_t start_offset = 0)
+    {
+        std::string result(hex_dump_size(in.size()), '\0');
+        hex_dump(in, result, start_offset);
+        return result;
+    }
+} // namespace ModernCpp
+
+#endif
@@ -0,0 +1,150 @@
+#include "md_view.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <vector>
+
+using ModernCpp::layout_left;
+using ModernCpp::layout_right;
+using ModernCpp::layout_tiled;
+using ModernCpp::md_view;
+
+TEST_CASE("md_view - layouts")
+{
+    std::vector<int> buffer(12);
+    std::iota(buffer.begin(), buffer.end(), 0);
+
+    SECTION("row-major")
+    {
+        md_view matrix{buffer, 3, 4};
+        static_assert(std::is_same_v<decltype(matrix), md_view<int, 2, layout_right>>);
+
+        REQUIRE(matrix.extent(0) == 3);
+        REQUIRE(matrix.extent(1) == 4);
+        REQUIRE(matrix(1, 2) == 6);
+        REQUIRE(std::ranges::equal(matrix.row(2), std::vector{8, 9, 10, 11}));
+    }
+
+    SECTION("column-major")
+    {
+        md_view<int, 2, layout_left> matrix{buffer, 3, 4};
+
+        REQUIRE(matrix(1, 2) == 7);
+        REQUIRE(std::ranges::equal(matrix.column(1), std::vector{3, 4, 5}));
+    }
+
+    SECTION("3D")
+    {
+        md_view cube{buffer, 2, 3, 2};
+
+        REQUIRE(cube(1, 2, 1) == 11);
+        REQUIRE(cube(1, 0, 0) == 6);
+    }
+
+    SECTION("tiled - extents padded to whole tiles")
+    {
+        std::vector<int> tiled_buffer(64, -1);
+        md_view<int, 2, layout_tiled<4>> matrix{tiled_buffer, 5, 6};
+
+        REQUIRE(matrix.size() == 30);
+        REQUIRE(matrix.required_span_size() == 2 * 2 * 16);
+
+        // every element has its own slot
+        for (size_t i = 0; i < 5; ++i)
+            for (size_t j = 0; j < 6; ++j)
+                matrix(i, j) = static_cast<int>(i * 6 + j);
+
+        std::vector<int> values;
+        std::ranges::copy_if(tiled_buffer, std::back_inserter(values), [](int v) { return v >= 0; });
+        std::ranges::sort(values);
+        REQUIRE(std::ranges::equal(values, std::views::iota(0, 30)));
+
+        // elements of one tile are contiguous
+        REQUIRE(&matrix(0, 3) + 1 == &matrix(1, 0));
+    }
+
+    SECTION("bounds")
+    {
+        md_view matrix{buffer, 3, 4};
+        REQUIRE_THROWS_AS(matrix.at(3, 0), std::out_of_range);
+        REQUIRE_THROWS_AS((md_view{buffer, 4, 4}), std::length_error);
+    }
+
+    SECTION("const view")
+    {
+        md_view matrix{buffer, 3, 4};
+        md_view<const int, 2> const_matrix = matrix;
+        REQUIRE(const_matrix(2, 3) == 11);
+    }
+}
+
+TEST_CASE("md_view - blocked iteration")
+{
+    SECTION("every index visited once")
+    {
+        std::vector<int> visits(37 * 53);
+        md_view matrix{visits, 37, 53};
+
+        ModernCpp::for_each_index_blocked(matrix, [&](size_t i, size_t j) { ++matrix(i, j); }, 8);
+
+        REQUIRE(std::ranges::all_of(visits, [](int count) { return count == 1; }));
+    }
+
+    SECTION("transpose between layouts")
+    {
+        const size_t rows = 45;
+        const size_t cols = 70;
+
+        std::vector<int> src_buffer(rows * cols);
+        std::iota(src_buffer.begin(), src_buffer.end(), 0);
+        md_view src{src_buffer, rows, cols};
+
+        std::vector<int> dst_buffer(cols * rows);
+        md_view dst{dst_buffer, cols, rows};
+        ModernCpp::transpose(src, dst, 16);
+
+        std::vector<int> tiled_buffer(80 * 48);
+        md_view<int, 2, layout_tiled<16>> tiled_dst{tiled_buffer, cols, rows};
+        ModernCpp::transpose(src, tiled_dst);
+
+        for (size_t i = 0; i < rows; ++i)
+            for (size_t j = 0; j < cols; ++j)
+            {
+                REQUIRE(dst(j, i) == src(i, j));
+                REQUIRE(tiled_dst(j, i) == src(i, j));
+            }
+
+        // transpose of a row-major matrix has the same buffer as the column-major copy
+        std::vector<int> col_major_buffer(rows * cols);
+        ModernCpp::copy(src, md_view<int, 2, layout_left>{col_major_buffer, rows, cols});
+        REQUIRE(col_major_buffer == dst_buffer);
+    }
+}
+
+TEST_CASE("md_view - transpose benchmark", "[.benchmark]")
+{
+    const size_t n = 1024;
+
+    std::vector<float> src_buffer(n * n);
+    std::iota(src_buffer.begin(), src_buffer.end(), 0.0f);
+    std::vector<float> dst_buffer(n * n);
+
+    md_view src{src_buffer, n, n};
+    md_view dst{dst_buffer, n, n};
+
+    BENCHMARK("row by row")
+    {
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+                dst(j, i) = src(i, j);
+        return dst(1, 0);
+    };
+
+    BENCHMARK("tiled")
+    {
+        ModernCpp::transpose(src, dst);
+        return dst(1, 0);
+    };
+}
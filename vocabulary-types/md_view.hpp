@@ -0,0 +1,346 @@
+#ifndef MD_VIEW_HPP
+#define MD_VIEW_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // layouts - map multidimensional indexes to offsets in a flat buffer (like std::mdspan's layouts)
+
+    // row-major - the last index is contiguous (C arrays)
+    struct layout_right
+    {
+        template <size_t Rank>
+        class mapping
+        {
+            std::array<size_t, Rank> extents_{};
+
+        public:
+            constexpr mapping() = default;
+
+            constexpr explicit mapping(const std::array<size_t, Rank>& extents) noexcept
+                : extents_{extents}
+            { }
+
+            constexpr const std::array<size_t, Rank>& extents() const noexcept
+            {
+                return extents_;
+            }
+
+            constexpr size_t operator()(const std::array<size_t, Rank>& indexes) const noexcept
+            {
+                size_t offset = 0;
+                for (size_t r = 0; r < Rank; ++r)
+                    offset = offset * extents_[r] + indexes[r];
+                return offset;
+            }
+
+            constexpr size_t required_span_size() const noexcept
+            {
+                size_t size = 1;
+                for (size_t extent : extents_)
+                    size *= extent;
+                return size;
+            }
+        };
+    };
+
+    // column-major - the first index is contiguous (Fortran, BLAS)
+    struct layout_left
+    {
+        template <size_t Rank>
+        class mapping
+        {
+            std::array<size_t, Rank> extents_{};
+
+        public:
+            constexpr mapping() = default;
+
+            constexpr explicit mapping(const std::array<size_t, Rank>& extents) noexcept
+                : extents_{extents}
+            { }
+
+            constexpr const std::array<size_t, Rank>& extents() const noexcept
+            {
+                return extents_;
+            }
+
+            constexpr size_t operator()(const std::array<size_t, Rank>& indexes) const noexcept
+            {
+                size_t offset = 0;
+                for (size_t r = Rank; r-- > 0;)
+                    offset = offset * extents_[r] + indexes[r];
+                return offset;
+            }
+
+            constexpr size_t required_span_size() const noexcept
+            {
+                size_t size = 1;
+                for (size_t extent : extents_)
+                    size *= extent;
+                return size;
+            }
+        };
+    };
+
+    // TileRows x TileCols tiles are stored contiguously (row-major inside a tile, tiles in row-major order);
+    // for Rank 3 the first index selects a 2D slice. Extents are padded up to whole tiles.
+    template <size_t TileRows, size_t TileCols = TileRows>
+    struct layout_tiled
+    {
+        static_assert(TileRows > 0 && TileCols > 0);
+
+        template <size_t Rank>
+        class mapping
+        {
+            static_assert(Rank == 2 || Rank == 3, "layout_tiled supports 2D & 3D views");
+
+            static constexpr size_t tile_size = TileRows * TileCols;
+
+            std::array<size_t, Rank> extents_{};
+            size_t tiles_per_row_ = 0;
+            size_t slice_size_ = 0;
+
+        public:
+            constexpr mapping() = default;
+
+            constexpr explicit mapping(const std::array<size_t, Rank>& extents) noexcept
+                : extents_{extents}
+                , tiles_per_row_{(extents[Rank - 1] + TileCols - 1) / TileCols}
+                , slice_size_{(extents[Rank - 2] + TileRows - 1) / TileRows * tiles_per_row_ * tile_size}
+            { }
+
+            constexpr const std::array<size_t, Rank>& extents() const noexcept
+            {
+                return extents_;
+            }
+
+            constexpr size_t operator()(const std::array<size_t, Rank>& indexes) const noexcept
+            {
+                const size_t i = indexes[Rank - 2];
+                const size_t j = indexes[Rank - 1];
+                const size_t offset = ((i / TileRows) * tiles_per_row_ + j / TileCols) * tile_size + (i % TileRows) * TileCols + j % TileCols;
+
+                if constexpr (Rank == 3)
+                    return indexes[0] * slice_size_ + offset;
+                else
+                    return offset;
+            }
+
+            constexpr size_t required_span_size() const noexcept
+            {
+                if constexpr (Rank == 3)
+                    return extents_[0] * slice_size_;
+                else
+                    return slice_size_;
+            }
+        };
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // md_view - non-owning multidimensional view of a flat buffer
+    //
+    //   std::vector<float> buffer(rows * cols);
+    //   md_view matrix{buffer, rows, cols};                   // row-major
+    //   md_view<float, 2, layout_left> fortran{ptr, rows, cols};
+    //   matrix(i, j) = 1.0f;
+    template <typename T, size_t Rank, typename Layout = layout_right>
+    class md_view
+    {
+    public:
+        using element_type = T;
+        using layout_type = Layout;
+        using mapping_type = typename Layout::template mapping<Rank>;
+
+        static constexpr size_t rank = Rank;
+
+    private:
+        T* data_ = nullptr;
+        mapping_type mapping_;
+
+    public:
+        constexpr md_view() = default;
+
+        constexpr md_view(T* data, const std::array<size_t, Rank>& extents)
+            : data_{data}
+            , mapping_{extents}
+        { }
+
+        template <std::convertible_to<size_t>... Extents>
+            requires(sizeof...(Extents) == Rank)
+        constexpr md_view(T* data, Extents... extents)
+            : md_view{data, std::array<size_t, Rank>{static_cast<size_t>(extents)...}}
+        { }
+
+        template <std::ranges::contiguous_range R, std::convertible_to<size_t>... Extents>
+            requires(sizeof...(Extents) == Rank) && std::ranges::sized_range<R>
+            && std::convertible_to<std::remove_reference_t<std::ranges::range_reference_t<R>> (*)[], T (*)[]>
+        constexpr md_view(R&& buffer, Extents... extents)
+            : md_view{std::ranges::data(buffer), std::array<size_t, Rank>{static_cast<size_t>(extents)...}}
+        {
+            if (static_cast<size_t>(std::ranges::size(buffer)) < mapping_.required_span_size())
+                throw std::length_error("md_view - buffer is too small for the extents");
+        }
+
+        // mutable view converts to const view
+        template <typename U>
+            requires std::is_const_v<T> && std::same_as<std::remove_const_t<T>, U>
+        constexpr md_view(const md_view<U, Rank, Layout>& other) noexcept
+            : data_{other.data()}
+            , mapping_{other.mapping()}
+        { }
+
+        template <std::convertible_to<size_t>... Indexes>
+            requires(sizeof...(Indexes) == Rank)
+        constexpr T& operator()(Indexes... indexes) const noexcept
+        {
+            return data_[mapping_(std::array<size_t, Rank>{static_cast<size_t>(indexes)...})];
+        }
+
+#ifdef __cpp_multidimensional_subscript
+        template <std::convertible_to<size_t>... Indexes>
+            requires(sizeof...(Indexes) == Rank)
+        constexpr T& operator[](Indexes... indexes) const noexcept
+        {
+            return (*this)(indexes...);
+        }
+#endif
+
+        template <std::convertible_to<size_t>... Indexes>
+            requires(sizeof...(Indexes) == Rank)
+        constexpr T& at(Indexes... indexes) const
+        {
+            const std::array<size_t, Rank> idx{static_cast<size_t>(indexes)...};
+            for (size_t r = 0; r < Rank; ++r)
+                if (idx[r] >= extent(r))
+                    throw std::out_of_range("md_view - index out of range");
+
+            return data_[mapping_(idx)];
+        }
+
+        constexpr size_t extent(size_t r) const noexcept
+        {
+            return mapping_.extents()[r];
+        }
+
+        constexpr const std::array<size_t, Rank>& extents() const noexcept
+        {
+            return mapping_.extents();
+        }
+
+        // number of elements
+        constexpr size_t size() const noexcept
+        {
+            size_t size = 1;
+            for (size_t e : extents())
+                size *= e;
+            return size;
+        }
+
+        // size of the buffer - greater than size() for padded layouts
+        constexpr size_t required_span_size() const noexcept
+        {
+            return mapping_.required_span_size();
+        }
+
+        constexpr T* data() const noexcept
+        {
+            return data_;
+        }
+
+        constexpr const mapping_type& mapping() const noexcept
+        {
+            return mapping_;
+        }
+
+        // contiguous row of a row-major matrix
+        constexpr std::span<T> row(size_t i) const noexcept
+            requires(Rank == 2) && std::same_as<Layout, layout_right>
+        {
+            return std::span<T>{data_ + i * extent(1), extent(1)};
+        }
+
+        // contiguous column of a column-major matrix
+        constexpr std::span<T> column(size_t j) const noexcept
+            requires(Rank == 2) && std::same_as<Layout, layout_left>
+        {
+            return std::span<T>{data_ + j * extent(0), extent(0)};
+        }
+    };
+
+    template <typename T, std::convertible_to<size_t>... Extents>
+    md_view(T*, Extents...) -> md_view<T, sizeof...(Extents)>;
+
+    template <std::ranges::contiguous_range R, std::convertible_to<size_t>... Extents>
+    md_view(R&&, Extents...) -> md_view<std::remove_reference_t<std::ranges::range_reference_t<R>>, sizeof...(Extents)>;
+
+    template <typename T, typename Layout = layout_right>
+    using matrix_view = md_view<T, 2, Layout>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // blocked iteration - visits a 2D index space block by block, so that the data touched
+    // by one block fits in cache (e.g. rows of the source & columns of the destination in transpose)
+
+    struct block_2d
+    {
+        size_t row_first;
+        size_t row_last;
+        size_t col_first;
+        size_t col_last;
+    };
+
+    inline constexpr size_t default_block_size = 32;
+
+    template <std::invocable<block_2d> F>
+    void for_each_block(size_t rows, size_t cols, size_t block_rows, size_t block_cols, F&& f)
+    {
+        if (block_rows == 0 || block_cols == 0)
+            throw std::invalid_argument("for_each_block - block size must be greater than zero");
+
+        for (size_t i = 0; i < rows; i += block_rows)
+            for (size_t j = 0; j < cols; j += block_cols)
+                std::invoke(f, block_2d{i, std::min(i + block_rows, rows), j, std::min(j + block_cols, cols)});
+    }
+
+    // f(i, j) for every element of the view - in blocked order
+    template <typename T, typename Layout, std::invocable<size_t, size_t> F>
+    void for_each_index_blocked(const md_view<T, 2, Layout>& view, F&& f, size_t block_size = default_block_size)
+    {
+        for_each_block(view.extent(0), view.extent(1), block_size, block_size, [&](const block_2d& block) {
+            for (size_t i = block.row_first; i < block.row_last; ++i)
+                for (size_t j = block.col_first; j < block.col_last; ++j)
+                    std::invoke(f, i, j);
+        });
+    }
+
+    // dst(i, j) = src(i, j) - converts between layouts
+    template <typename T, typename U, typename LayoutSrc, typename LayoutDst>
+    void copy(const md_view<T, 2, LayoutSrc>& src, const md_view<U, 2, LayoutDst>& dst, size_t block_size = default_block_size)
+    {
+        if (src.extents() != dst.extents())
+            throw std::length_error("copy - views of different extents");
+
+        for_each_index_blocked(src, [&](size_t i, size_t j) { dst(i, j) = src(i, j); }, block_size);
+    }
+
+    // dst(j, i) = src(i, j) - tiled, so both matrices are accessed in cache-sized blocks
+    template <typename T, typename U, typename LayoutSrc, typename LayoutDst>
+    void transpose(const md_view<T, 2, LayoutSrc>& src, const md_view<U, 2, LayoutDst>& dst, size_t tile_size = default_block_size)
+    {
+        if (src.extent(0) != dst.extent(1) || src.extent(1) != dst.extent(0))
+            throw std::length_error("transpose - extents of dst must be extents of src swapped");
+
+        for_each_index_blocked(src, [&](size_t i, size_t j) { dst(j, i) = src(i, j); }, tile_size);
+    }
+} // namespace ModernCpp
+
+#endif
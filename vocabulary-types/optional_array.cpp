@@ -0,0 +1,105 @@
+#include "optional_array.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <charconv>
+#include <iostream>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    std::optional<int> to_int(std::string_view str)
+    {
+        int value{};
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+
+        if (ec == std::errc{} && ptr == str.data() + str.size())
+            return value;
+
+        return std::nullopt;
+    }
+} // namespace
+
+static_assert(std::ranges::random_access_range<ModernCpp::optional_array<int>>);
+static_assert(std::same_as<std::ranges::range_reference_t<ModernCpp::optional_array<int>>, std::optional<int>>);
+
+TEST_CASE("optional_array")
+{
+    using ModernCpp::optional_array;
+
+    SECTION("push_back & access")
+    {
+        optional_array<int> arr;
+        arr.push_back(1);
+        arr.push_back(std::nullopt);
+        arr.push_back(std::optional{3});
+
+        REQUIRE(arr.size() == 3);
+        REQUIRE(arr[0] == 1);
+        REQUIRE_FALSE(arr[1].has_value());
+        REQUIRE(arr.value_or(1, -1) == -1);
+        REQUIRE(arr.at(2) == 3);
+        REQUIRE_THROWS_AS(arr.at(3), std::out_of_range);
+        REQUIRE(arr.count() == 2);
+    }
+
+    SECTION("iteration yields std::optional<T>")
+    {
+        optional_array<int> arr = {1, std::nullopt, 3, std::nullopt};
+
+        std::vector<std::optional<int>> items(arr.begin(), arr.end());
+        REQUIRE(items == std::vector<std::optional<int>>{1, std::nullopt, 3, std::nullopt});
+
+        auto engaged = arr | std::views::filter([](auto opt) { return opt.has_value(); })
+                           | std::views::transform([](auto opt) { return *opt; });
+        REQUIRE(std::ranges::equal(engaged, std::vector{1, 3}));
+
+        REQUIRE(*(arr.end() - 2) == 3);
+    }
+
+    SECTION("bitmap spans many words")
+    {
+        optional_array<int> arr;
+        for (int i = 0; i < 1'000; ++i)
+        {
+            if (i % 3 == 0)
+                arr.push_back(i);
+            else
+                arr.push_back(std::nullopt);
+        }
+
+        REQUIRE(arr.count() == 334);
+        REQUIRE(arr[999] == 999);
+        REQUIRE_FALSE(arr[998].has_value());
+    }
+
+    SECTION("bulk parse results")
+    {
+        const std::vector tokens = {"123"sv, "a"sv, "42"sv, "123a4"sv, "-7"sv};
+
+        optional_array<int> results(tokens | std::views::transform(to_int));
+
+        REQUIRE(results.size() == tokens.size());
+        REQUIRE(std::ranges::equal(results, std::vector<std::optional<int>>{123, std::nullopt, 42, std::nullopt, -7}));
+    }
+
+    SECTION("memory footprint")
+    {
+        constexpr size_t n = 1'000'000;
+
+        optional_array<int> arr;
+        arr.reserve(n);
+        for (size_t i = 0; i < n; ++i)
+            arr.push_back(static_cast<int>(i));
+
+        const double bytes_per_item = static_cast<double>(arr.memory_footprint()) / n;
+        std::cout << "optional_array<int>: " << bytes_per_item << " bytes/item vs sizeof(std::optional<int>) = "
+                  << sizeof(std::optional<int>) << "\n";
+
+        REQUIRE(bytes_per_item < 4.2);
+    }
+}
@@ -0,0 +1,266 @@
+#ifndef OPTIONAL_ARRAY_HPP
+#define OPTIONAL_ARRAY_HPP
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+namespace ModernCpp
+{
+    // Columnar storage for a sequence of std::optional<T>:
+    // values are kept densely in one vector and "has_value" flags in a separate bitmap,
+    // so optional_array<int> needs ~4.125 bytes per item instead of sizeof(std::optional<int>) == 8
+    template <std::semiregular T>
+    class optional_array
+    {
+        using word_type = std::uint64_t;
+        static constexpr size_t bits_per_word = 64;
+
+        std::vector<T> values_;
+        std::vector<word_type> valid_bits_;
+
+        static constexpr size_t words_for(size_t count) noexcept
+        {
+            return (count + bits_per_word - 1) / bits_per_word;
+        }
+
+    public:
+        using value_type = std::optional<T>;
+        using size_type = size_t;
+
+        class const_iterator
+        {
+            const optional_array* array_ = nullptr;
+            std::ptrdiff_t index_ = 0;
+
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag; // operator* returns a prvalue
+            using value_type = std::optional<T>;
+            using difference_type = std::ptrdiff_t;
+
+            const_iterator() = default;
+
+            const_iterator(const optional_array* array, std::ptrdiff_t index)
+                : array_{array}
+                , index_{index}
+            { }
+
+            std::optional<T> operator*() const
+            {
+                return (*array_)[static_cast<size_t>(index_)];
+            }
+
+            std::optional<T> operator[](difference_type n) const
+            {
+                return *(*this + n);
+            }
+
+            const_iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                auto tmp = *this;
+                ++index_;
+                return tmp;
+            }
+
+            const_iterator& operator--()
+            {
+                --index_;
+                return *this;
+            }
+
+            const_iterator operator--(int)
+            {
+                auto tmp = *this;
+                --index_;
+                return tmp;
+            }
+
+            const_iterator& operator+=(difference_type n)
+            {
+                index_ += n;
+                return *this;
+            }
+
+            const_iterator& operator-=(difference_type n)
+            {
+                index_ -= n;
+                return *this;
+            }
+
+            friend const_iterator operator+(const_iterator it, difference_type n)
+            {
+                return it += n;
+            }
+
+            friend const_iterator operator+(difference_type n, const_iterator it)
+            {
+                return it += n;
+            }
+
+            friend const_iterator operator-(const_iterator it, difference_type n)
+            {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs)
+            {
+                return lhs.index_ - rhs.index_;
+            }
+
+            bool operator==(const const_iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+
+            auto operator<=>(const const_iterator& other) const
+            {
+                return index_ <=> other.index_;
+            }
+        };
+
+        using iterator = const_iterator;
+
+        optional_array() = default;
+
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, std::optional<T>>
+        explicit optional_array(R&& rng)
+        {
+            if constexpr (std::ranges::sized_range<R>)
+                reserve(std::ranges::size(rng));
+
+            for (auto&& item : rng)
+                push_back(std::optional<T>(std::forward<decltype(item)>(item)));
+        }
+
+        optional_array(std::initializer_list<std::optional<T>> items)
+            : optional_array(std::views::all(items))
+        { }
+
+        size_t size() const noexcept
+        {
+            return values_.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return values_.empty();
+        }
+
+        void reserve(size_t capacity)
+        {
+            values_.reserve(capacity);
+            valid_bits_.reserve(words_for(capacity));
+        }
+
+        void clear() noexcept
+        {
+            values_.clear();
+            valid_bits_.clear();
+        }
+
+        void push_back(const T& value)
+        {
+            append(value, true);
+        }
+
+        void push_back(std::nullopt_t)
+        {
+            append(T{}, false);
+        }
+
+        void push_back(const std::optional<T>& item)
+        {
+            if (item)
+                push_back(*item);
+            else
+                push_back(std::nullopt);
+        }
+
+        bool has_value(size_t index) const noexcept
+        {
+            return (valid_bits_[index / bits_per_word] >> (index % bits_per_word)) & 1u;
+        }
+
+        std::optional<T> operator[](size_t index) const
+        {
+            if (has_value(index))
+                return values_[index];
+            return std::nullopt;
+        }
+
+        std::optional<T> at(size_t index) const
+        {
+            if (index >= size())
+                throw std::out_of_range("optional_array::at - index out of range");
+            return (*this)[index];
+        }
+
+        T value_or(size_t index, const T& default_value) const
+        {
+            return has_value(index) ? values_[index] : default_value;
+        }
+
+        // number of engaged items - popcount over the bitmap
+        size_t count() const noexcept
+        {
+            size_t result = 0;
+            for (word_type word : valid_bits_)
+                result += std::popcount(word);
+            return result;
+        }
+
+        // dense values (disengaged slots hold T{}) - suitable for bulk processing with has_value() as a mask
+        const std::vector<T>& values() const noexcept
+        {
+            return values_;
+        }
+
+        // bytes allocated for values and bitmap
+        size_t memory_footprint() const noexcept
+        {
+            return values_.capacity() * sizeof(T) + valid_bits_.capacity() * sizeof(word_type);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator{this, 0};
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator{this, static_cast<std::ptrdiff_t>(size())};
+        }
+
+    private:
+        void append(const T& value, bool is_valid)
+        {
+            const size_t index = values_.size();
+
+            if (index % bits_per_word == 0)
+                valid_bits_.push_back(0);
+
+            values_.push_back(value);
+
+            if (is_valid)
+                valid_bits_.back() |= word_type{1} << (index % bits_per_word);
+        }
+    };
+} // namespace ModernCpp
+
+#endif
@@ -0,0 +1,182 @@
+#include "span_kernels.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace sk = ModernCpp::span_kernels;
+
+namespace
+{
+    std::vector<sk::isa> available_isas()
+    {
+        std::vector<sk::isa> isas{sk::isa::scalar};
+        if (sk::best_isa() >= sk::isa::avx2)
+            isas.push_back(sk::isa::avx2);
+        if (sk::best_isa() >= sk::isa::avx512)
+            isas.push_back(sk::isa::avx512);
+        return isas;
+    }
+
+    std::string_view isa_name(sk::isa instruction_set)
+    {
+        switch (instruction_set)
+        {
+        case sk::isa::avx512:
+            return "avx512";
+        case sk::isa::avx2:
+            return "avx2";
+        default:
+            return "scalar";
+        }
+    }
+
+    bool close_to(double a, double b)
+    {
+        return std::abs(a - b) <= 1e-6 * std::max(1.0, std::abs(b));
+    }
+
+    // best of a few runs - bytes / second
+    double measure_gbps(size_t bytes, auto&& f)
+    {
+        using namespace std::chrono;
+
+        double best = 0.0;
+        for (int run = 0; run < 10; ++run)
+        {
+            const auto start = steady_clock::now();
+            f();
+            const duration<double> elapsed = steady_clock::now() - start;
+            best = std::max(best, bytes / elapsed.count() / 1e9);
+        }
+        return best;
+    }
+
+    void report(std::string_view kernel, std::string_view version, double gbps)
+    {
+        std::cout << std::left << std::setw(8) << kernel << std::setw(24) << version
+                  << std::right << std::fixed << std::setprecision(2) << std::setw(8) << gbps << " GB/s\n";
+    }
+} // namespace
+
+TEST_CASE("span kernels")
+{
+    // sizes not divisible by vector widths test the tails
+    for (size_t size : {0u, 1u, 7u, 63u, 1000u, 4099u})
+    {
+        std::vector<float> x(size);
+        std::vector<float> y(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            x[i] = static_cast<float>(i % 17) - 8.0f;
+            y[i] = static_cast<float>(i % 5);
+        }
+
+        for (sk::isa instruction_set : available_isas())
+        {
+            DYNAMIC_SECTION("size " << size << " - " << isa_name(instruction_set))
+            {
+                SECTION("fill")
+                {
+                    std::vector<float> data(size);
+                    sk::fill(instruction_set, data, 3.5f);
+                    REQUIRE(std::ranges::all_of(data, [](float v) { return v == 3.5f; }));
+                }
+
+                SECTION("axpy")
+                {
+                    std::vector<float> expected = y;
+                    std::ranges::transform(x, expected, expected.begin(), [](float a, float b) { return 2.0f * a + b; });
+
+                    sk::axpy(instruction_set, 2.0f, x, y);
+                    REQUIRE(y == expected);
+                }
+
+                SECTION("sum")
+                {
+                    REQUIRE(close_to(sk::sum(instruction_set, x), std::accumulate(x.begin(), x.end(), 0.0)));
+                }
+
+                SECTION("dot")
+                {
+                    REQUIRE(close_to(sk::dot(instruction_set, x, y), std::inner_product(x.begin(), x.end(), y.begin(), 0.0)));
+                }
+
+                SECTION("minmax")
+                {
+                    if (size == 0)
+                    {
+                        REQUIRE_THROWS_AS(sk::minmax(instruction_set, x), std::invalid_argument);
+                    }
+                    else
+                    {
+                        auto [min, max] = sk::minmax(instruction_set, x);
+                        auto expected = std::ranges::minmax(x);
+                        REQUIRE(min == expected.min);
+                        REQUIRE(max == expected.max);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("span kernels - integers & spans")
+{
+    std::vector<std::int32_t> data(1000);
+    std::iota(data.begin(), data.end(), -500);
+
+    std::span<const std::int32_t> view{data};
+    REQUIRE(sk::sum(view) == std::accumulate(data.begin(), data.end(), 0));
+    REQUIRE(sk::dot(view, view) == std::inner_product(data.begin(), data.end(), data.begin(), 0));
+
+    auto [min, max] = sk::minmax(view.subspan(100, 50));
+    REQUIRE(min == -400);
+    REQUIRE(max == -351);
+
+    sk::fill(std::span{data}.first(10), 42);
+    REQUIRE(std::ranges::count(data, 42) == 11); // 42 was already in data
+
+    std::vector<std::int32_t> other(999);
+    REQUIRE_THROWS_AS(sk::dot(data, other), std::length_error);
+}
+
+TEST_CASE("span kernels - GB/s vs STL", "[.benchmark]")
+{
+    constexpr size_t size = 1 << 20;
+    constexpr size_t bytes = size * sizeof(float);
+
+    std::vector<float> x(size, 1.0f);
+    std::vector<float> y(size, 2.0f);
+    volatile float sink = 0.0f;
+
+    std::cout << "\nspan kernels - " << size << " floats\n";
+
+    report("fill", "std::ranges::fill", measure_gbps(bytes, [&] { std::ranges::fill(y, 2.0f); }));
+    report("sum", "std::accumulate", measure_gbps(bytes, [&] { sink = std::accumulate(x.begin(), x.end(), 0.0f); }));
+    report("dot", "std::inner_product", measure_gbps(2 * bytes, [&] { sink = std::inner_product(x.begin(), x.end(), y.begin(), 0.0f); }));
+    report("minmax", "std::ranges::minmax", measure_gbps(bytes, [&] { sink = std::ranges::minmax(x).max; }));
+    report("axpy", "std::transform", measure_gbps(3 * bytes, [&] {
+        std::transform(x.begin(), x.end(), y.begin(), y.begin(), [](float a, float b) { return 0.5f * a + b; });
+    }));
+
+    for (sk::isa instruction_set : available_isas())
+    {
+        const std::string version = "span_kernels::" + std::string(isa_name(instruction_set));
+
+        report("fill", version, measure_gbps(bytes, [&] { sk::fill(instruction_set, y, 2.0f); }));
+        report("sum", version, measure_gbps(bytes, [&] { sink = sk::sum(instruction_set, x); }));
+        report("dot", version, measure_gbps(2 * bytes, [&] { sink = sk::dot(instruction_set, x, y); }));
+        report("minmax", version, measure_gbps(bytes, [&] { sink = sk::minmax(instruction_set, x).max; }));
+        report("axpy", version, measure_gbps(3 * bytes, [&] { sk::axpy(instruction_set, 0.5f, x, y); }));
+    }
+}
@@ -0,0 +1,433 @@
+#ifndef SPAN_KERNELS_HPP
+#define SPAN_KERNELS_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MODERNCPP_SPAN_KERNELS_X86_DISPATCH 1
+#endif
+
+namespace ModernCpp::span_kernels
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // batched kernels over std::span (and other contiguous ranges) - fill, axpy, sum, minmax, dot
+    //
+    // Every kernel is compiled for AVX-512, AVX2+FMA and plain scalar code; the best version
+    // supported by the CPU is selected at runtime, so the binary does not require -mavx2.
+    // Reductions (sum, dot) use several vector accumulators - results of floating-point
+    // reductions may differ from std::accumulate in the last bits (different summation order).
+
+    enum class isa
+    {
+        scalar,
+        avx2,
+        avx512
+    };
+
+    inline isa detect_isa() noexcept
+    {
+#ifdef MODERNCPP_SPAN_KERNELS_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            return isa::avx512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return isa::avx2;
+#endif
+        return isa::scalar;
+    }
+
+    // the instruction set used by kernels called without an explicit isa
+    inline isa best_isa() noexcept
+    {
+        static const isa detected = detect_isa();
+        return detected;
+    }
+
+    template <typename T>
+    concept Arithmetic = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    template <typename T>
+    struct minmax_result
+    {
+        T min;
+        T max;
+    };
+
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////////////////////////
+        // scalar versions
+
+        template <typename T>
+        void fill_scalar(T* data, size_t size, T value)
+        {
+            std::fill_n(data, size, value);
+        }
+
+        template <typename T>
+        void axpy_scalar(T a, const T* x, T* y, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                y[i] = a * x[i] + y[i];
+        }
+
+        template <typename T>
+        T sum_scalar(const T* data, size_t size)
+        {
+            T total{};
+            for (size_t i = 0; i < size; ++i)
+                total += data[i];
+            return total;
+        }
+
+        template <typename T>
+        T dot_scalar(const T* x, const T* y, size_t size)
+        {
+            T total{};
+            for (size_t i = 0; i < size; ++i)
+                total += x[i] * y[i];
+            return total;
+        }
+
+        template <typename T>
+        minmax_result<T> minmax_scalar(const T* data, size_t size)
+        {
+            minmax_result<T> result{data[0], data[0]};
+            for (size_t i = 1; i < size; ++i)
+            {
+                result.min = data[i] < result.min ? data[i] : result.min;
+                result.max = result.max < data[i] ? data[i] : result.max;
+            }
+            return result;
+        }
+
+#ifdef MODERNCPP_SPAN_KERNELS_X86_DISPATCH
+        ////////////////////////////////////////////////////////////////////////////////
+        // vector versions - written with generic vector extensions and always inlined
+        // into the target-specific entry points below, so one body serves every vector width
+
+        template <typename T, size_t Bytes>
+        struct vector
+        {
+            typedef T type __attribute__((vector_size(Bytes)));
+            static constexpr size_t lanes = Bytes / sizeof(T);
+        };
+
+        template <typename T, size_t Bytes>
+        using vector_t = typename vector<T, Bytes>::type;
+
+        // vectors are passed by reference - helpers are compiled without the target's vector ABI
+        template <typename V, typename T>
+        [[gnu::always_inline]] inline void load(V& v, const T* ptr)
+        {
+            std::memcpy(&v, ptr, sizeof(V));
+        }
+
+        template <typename V, typename T>
+        [[gnu::always_inline]] inline void store(T* ptr, const V& v)
+        {
+            std::memcpy(ptr, &v, sizeof(V));
+        }
+
+        template <typename T, size_t Bytes>
+        [[gnu::always_inline]] inline void fill_vector(T* data, size_t size, T value)
+        {
+            using V = vector_t<T, Bytes>;
+            constexpr size_t lanes = vector<T, Bytes>::lanes;
+
+            const V v = V{} + value;
+
+            size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+                store(data + i, v);
+            for (; i < size; ++i)
+                data[i] = value;
+        }
+
+        template <typename T, size_t Bytes>
+        [[gnu::always_inline]] inline void axpy_vector(T a, const T* x, T* y, size_t size)
+        {
+            using V = vector_t<T, Bytes>;
+            constexpr size_t lanes = vector<T, Bytes>::lanes;
+
+            const V va = V{} + a;
+
+            size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                V vx, vy;
+                load(vx, x + i);
+                load(vy, y + i);
+                store(y + i, V(va * vx + vy));
+            }
+            for (; i < size; ++i)
+                y[i] = a * x[i] + y[i];
+        }
+
+        template <typename T>
+        struct load_value
+        {
+            const T* data;
+
+            template <typename V>
+            [[gnu::always_inline]] void get(V& v, size_t i) const
+            {
+                load(v, data + i);
+            }
+        };
+
+        template <typename T>
+        struct load_product
+        {
+            const T* x;
+            const T* y;
+
+            template <typename V>
+            [[gnu::always_inline]] void get(V& v, size_t i) const
+            {
+                V vy;
+                load(v, x + i);
+                load(vy, y + i);
+                v *= vy;
+            }
+        };
+
+        // sum of source.get(i) for i in [0, size)
+        template <typename T, size_t Bytes, typename Source>
+        [[gnu::always_inline]] inline T reduce_vector(const Source& source, size_t size)
+        {
+            using V = vector_t<T, Bytes>;
+            constexpr size_t lanes = vector<T, Bytes>::lanes;
+
+            // 4 independent accumulators hide the latency of vector additions
+            V acc0{}, acc1{}, acc2{}, acc3{};
+            V v0, v1, v2, v3;
+
+            size_t i = 0;
+            for (; i + 4 * lanes <= size; i += 4 * lanes)
+            {
+                source.get(v0, i);
+                source.get(v1, i + lanes);
+                source.get(v2, i + 2 * lanes);
+                source.get(v3, i + 3 * lanes);
+                acc0 += v0;
+                acc1 += v1;
+                acc2 += v2;
+                acc3 += v3;
+            }
+            for (; i + lanes <= size; i += lanes)
+            {
+                source.get(v0, i);
+                acc0 += v0;
+            }
+
+            const V acc = (acc0 + acc1) + (acc2 + acc3);
+
+            T total{};
+            for (size_t lane = 0; lane < lanes; ++lane)
+                total += acc[lane];
+            for (T value; i < size; ++i)
+            {
+                source.get(value, i);
+                total += value;
+            }
+
+            return total;
+        }
+
+        template <typename T, size_t Bytes>
+        [[gnu::always_inline]] inline T sum_vector(const T* data, size_t size)
+        {
+            return reduce_vector<T, Bytes>(load_value<T>{data}, size);
+        }
+
+        template <typename T, size_t Bytes>
+        [[gnu::always_inline]] inline T dot_vector(const T* x, const T* y, size_t size)
+        {
+            return reduce_vector<T, Bytes>(load_product<T>{x, y}, size);
+        }
+
+        template <typename T, size_t Bytes>
+        [[gnu::always_inline]] inline minmax_result<T> minmax_vector(const T* data, size_t size)
+        {
+            using V = vector_t<T, Bytes>;
+            constexpr size_t lanes = vector<T, Bytes>::lanes;
+
+            V vmin = V{} + data[0];
+            V vmax = vmin;
+
+            size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                V v;
+                load(v, data + i);
+                vmin = v < vmin ? v : vmin;
+                vmax = vmax < v ? v : vmax;
+            }
+
+            minmax_result<T> result{vmin[0], vmax[0]};
+            for (size_t lane = 1; lane < lanes; ++lane)
+            {
+                result.min = vmin[lane] < result.min ? vmin[lane] : result.min;
+                result.max = result.max < vmax[lane] ? vmax[lane] : result.max;
+            }
+            for (; i < size; ++i)
+            {
+                result.min = data[i] < result.min ? data[i] : result.min;
+                result.max = result.max < data[i] ? data[i] : result.max;
+            }
+
+            return result;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // target-specific entry points
+
+#define MODERNCPP_SPAN_KERNELS_DEFINE_TARGET(name, target_spec, bytes)                                               \
+        template <typename T>                                                                                 \
+        [[gnu::target(target_spec)]] void fill_##name(T* data, size_t size, T value)                                \
+        {                                                                                                     \
+            fill_vector<T, bytes>(data, size, value);                                                         \
+        }                                                                                                     \
+                                                                                                              \
+        template <typename T>                                                                                 \
+        [[gnu::target(target_spec)]] void axpy_##name(T a, const T* x, T* y, size_t size)                           \
+        {                                                                                                     \
+            axpy_vector<T, bytes>(a, x, y, size);                                                             \
+        }                                                                                                     \
+                                                                                                              \
+        template <typename T>                                                                                 \
+        [[gnu::target(target_spec)]] T sum_##name(const T* data, size_t size)                                       \
+        {                                                                                                     \
+            return sum_vector<T, bytes>(data, size);                                                          \
+        }                                                                                                     \
+                                                                                                              \
+        template <typename T>                                                                                 \
+        [[gnu::target(target_spec)]] T dot_##name(const T* x, const T* y, size_t size)                              \
+        {                                                                                                     \
+            return dot_vector<T, bytes>(x, y, size);                                                          \
+        }                                                                                                     \
+                                                                                                              \
+        template <typename T>                                                                                 \
+        [[gnu::target(target_spec)]] minmax_result<T> minmax_##name(const T* data, size_t size)                     \
+        {                                                                                                     \
+            return minmax_vector<T, bytes>(data, size);                                                       \
+        }
+
+        MODERNCPP_SPAN_KERNELS_DEFINE_TARGET(avx2, "avx2,fma", 32)
+        MODERNCPP_SPAN_KERNELS_DEFINE_TARGET(avx512, "avx512f,avx512bw", 64)
+
+#undef MODERNCPP_SPAN_KERNELS_DEFINE_TARGET
+
+#define MODERNCPP_SPAN_KERNELS_DISPATCH(kernel, instruction_set, ...) \
+    switch (instruction_set)                                          \
+    {                                                                 \
+    case isa::avx512:                                                 \
+        return detail::kernel##_avx512(__VA_ARGS__);                  \
+    case isa::avx2:                                                   \
+        return detail::kernel##_avx2(__VA_ARGS__);                    \
+    default:                                                          \
+        return detail::kernel##_scalar(__VA_ARGS__);                  \
+    }
+#else
+#define MODERNCPP_SPAN_KERNELS_DISPATCH(kernel, instruction_set, ...) \
+    return detail::kernel##_scalar(__VA_ARGS__);
+#endif
+    } // namespace detail
+
+    template <typename R>
+    concept ArithmeticSpan = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+        && Arithmetic<std::ranges::range_value_t<R>>;
+
+    template <typename R>
+    concept MutableArithmeticSpan = ArithmeticSpan<R> && !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+    template <MutableArithmeticSpan R>
+    void fill(isa instruction_set, R&& data, std::ranges::range_value_t<R> value)
+    {
+        MODERNCPP_SPAN_KERNELS_DISPATCH(fill, instruction_set, std::ranges::data(data), std::ranges::size(data), value)
+    }
+
+    // y = a * x + y
+    template <ArithmeticSpan X, MutableArithmeticSpan Y>
+        requires std::same_as<std::ranges::range_value_t<X>, std::ranges::range_value_t<Y>>
+    void axpy(isa instruction_set, std::ranges::range_value_t<Y> a, X&& x, Y&& y)
+    {
+        if (std::ranges::size(x) != std::ranges::size(y))
+            throw std::length_error("axpy - ranges of different sizes");
+
+        MODERNCPP_SPAN_KERNELS_DISPATCH(axpy, instruction_set, a, std::ranges::data(x), std::ranges::data(y), std::ranges::size(y))
+    }
+
+    template <ArithmeticSpan R>
+    std::ranges::range_value_t<R> sum(isa instruction_set, R&& data)
+    {
+        MODERNCPP_SPAN_KERNELS_DISPATCH(sum, instruction_set, std::ranges::data(data), std::ranges::size(data))
+    }
+
+    template <ArithmeticSpan X, ArithmeticSpan Y>
+        requires std::same_as<std::ranges::range_value_t<X>, std::ranges::range_value_t<Y>>
+    std::ranges::range_value_t<X> dot(isa instruction_set, X&& x, Y&& y)
+    {
+        if (std::ranges::size(x) != std::ranges::size(y))
+            throw std::length_error("dot - ranges of different sizes");
+
+        MODERNCPP_SPAN_KERNELS_DISPATCH(dot, instruction_set, std::ranges::data(x), std::ranges::data(y), std::ranges::size(x))
+    }
+
+    // NaNs are not ordered - results for data containing NaNs are unspecified
+    template <ArithmeticSpan R>
+    minmax_result<std::ranges::range_value_t<R>> minmax(isa instruction_set, R&& data)
+    {
+        if (std::ranges::empty(data))
+            throw std::invalid_argument("minmax - empty range");
+
+        MODERNCPP_SPAN_KERNELS_DISPATCH(minmax, instruction_set, std::ranges::data(data), std::ranges::size(data))
+    }
+
+#undef MODERNCPP_SPAN_KERNELS_DISPATCH
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // runtime-dispatched versions
+
+    template <MutableArithmeticSpan R>
+    void fill(R&& data, std::ranges::range_value_t<R> value)
+    {
+        fill(best_isa(), data, value);
+    }
+
+    template <ArithmeticSpan X, MutableArithmeticSpan Y>
+        requires std::same_as<std::ranges::range_value_t<X>, std::ranges::range_value_t<Y>>
+    void axpy(std::ranges::range_value_t<Y> a, X&& x, Y&& y)
+    {
+        axpy(best_isa(), a, x, y);
+    }
+
+    template <ArithmeticSpan R>
+    std::ranges::range_value_t<R> sum(R&& data)
+    {
+        return sum(best_isa(), data);
+    }
+
+    template <ArithmeticSpan X, ArithmeticSpan Y>
+        requires std::same_as<std::ranges::range_value_t<X>, std::ranges::range_value_t<Y>>
+    std::ranges::range_value_t<X> dot(X&& x, Y&& y)
+    {
+        return dot(best_isa(), x, y);
+    }
+
+    template <ArithmeticSpan R>
+    minmax_result<std::ranges::range_value_t<R>> minmax(R&& data)
+    {
+        return minmax(best_isa(), data);
+    }
+} // namespace ModernCpp::span_kernels
+
+#endif
@@ -0,0 +1,114 @@
+#include "string_arena.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    std::string read_line()
+    {
+        return "One Two Three";
+    }
+
+    std::string_view after_word(std::string_view text, std::string_view word)
+    {
+        return text.substr(text.find(word) + word.size());
+    }
+} // namespace
+
+TEST_CASE("string_arena")
+{
+    ModernCpp::string_arena arena;
+
+    SECTION("views of temporaries stay valid")
+    {
+        auto tail = after_word(arena.store(read_line()), "One"); // no dangling - text lives in the arena
+        std::string_view token = arena.store("text"s);
+
+        REQUIRE(tail == " Two Three");
+        REQUIRE(token == "text");
+    }
+
+    SECTION("tokens from a reused input buffer")
+    {
+        std::istringstream input{"ala ma kota ala"};
+        std::string buffer;
+        std::vector<std::string_view> tokens;
+
+        while (input >> buffer)
+            tokens.push_back(arena.store(buffer));
+
+        REQUIRE(tokens == std::vector{"ala"sv, "ma"sv, "kota"sv, "ala"sv});
+        REQUIRE(arena.bytes_used() == 12);
+    }
+
+    SECTION("bulk append copies all texts into one block")
+    {
+        std::vector<std::string> words = {"one", "two", "", "three"};
+
+        auto views = arena.store_all(words);
+        words.clear();
+
+        REQUIRE(views == std::vector{"one"sv, "two"sv, ""sv, "three"sv});
+        REQUIRE(views[1].data() == views[0].data() + 3);
+    }
+
+    SECTION("bulk append of temporaries")
+    {
+        const std::vector<std::string> words = {"one", "two", "three"};
+        size_t calls = 0;
+
+        auto views = arena.store_all(words | std::views::transform([&](const std::string& w) {
+            ++calls;
+            return w + "!";
+        }));
+
+        REQUIRE(views == std::vector{"one!"sv, "two!"sv, "three!"sv});
+        REQUIRE(calls == words.size()); // every temporary is created once
+    }
+
+    SECTION("bulk append from input range")
+    {
+        std::istringstream input{"a bb ccc"};
+
+        auto views = arena.store_all(std::views::istream<std::string>(input));
+
+        REQUIRE(views == std::vector{"a"sv, "bb"sv, "ccc"sv});
+    }
+
+    SECTION("texts larger than a chunk")
+    {
+        ModernCpp::string_arena small_arena{16};
+
+        auto small = small_arena.store("0123456789");
+        auto large = small_arena.store(std::string(100, 'x'));
+        auto next = small_arena.store("abc");
+
+        REQUIRE(small == "0123456789");
+        REQUIRE(large == std::string(100, 'x'));
+        REQUIRE(next == "abc");
+        REQUIRE(small_arena.bytes_used() == 113);
+    }
+
+    SECTION("reset keeps the first chunk for reuse")
+    {
+        ModernCpp::string_arena small_arena{16};
+
+        for (int i = 0; i < 100; ++i)
+            small_arena.store("0123456789");
+        REQUIRE(small_arena.bytes_allocated() == 100 * 16);
+
+        small_arena.reset();
+
+        REQUIRE(small_arena.bytes_used() == 0);
+        REQUIRE(small_arena.bytes_allocated() == 16);
+        REQUIRE(small_arena.store("abc") == "abc");
+        REQUIRE(small_arena.bytes_allocated() == 16);
+    }
+}
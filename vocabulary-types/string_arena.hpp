@@ -0,0 +1,152 @@
+#ifndef STRING_ARENA_HPP
+#define STRING_ARENA_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // string_arena - owning storage for characters of many strings
+    //
+    // store() copies text into large chunks and returns a std::string_view that stays valid
+    // until reset() or destruction of the arena - zero-copy tokens can be kept from transient
+    // inputs (temporaries, reused read buffers) without a std::string allocation per token.
+    // Memory is released in bulk, never per string: reset() frees every chunk except the first one, which is reused.
+    class string_arena
+    {
+        struct Chunk
+        {
+            std::unique_ptr<char[]> data;
+            size_t size;
+        };
+
+        size_t chunk_size_;
+        std::vector<Chunk> chunks_;
+        std::vector<Chunk> large_chunks_; // dedicated allocations for strings longer than chunk_size_
+        size_t used_ = 0;                 // bytes used in chunks_.back()
+        size_t bytes_used_ = 0;
+
+        char* allocate_in_chunks(size_t size)
+        {
+            if (chunks_.empty() || size > chunks_.back().size - used_)
+            {
+                chunks_.push_back(Chunk{std::make_unique_for_overwrite<char[]>(chunk_size_), chunk_size_});
+                used_ = 0;
+            }
+
+            char* ptr = chunks_.back().data.get() + used_;
+            used_ += size;
+            return ptr;
+        }
+
+    public:
+        static constexpr size_t default_chunk_size = 64 * 1024;
+
+        explicit string_arena(size_t chunk_size = default_chunk_size)
+            : chunk_size_{std::max<size_t>(chunk_size, 1)}
+        { }
+
+        string_arena(const string_arena&) = delete;
+        string_arena& operator=(const string_arena&) = delete;
+        string_arena(string_arena&&) noexcept = default;
+        string_arena& operator=(string_arena&&) noexcept = default;
+
+        // uninitialized storage for size chars - valid until reset()
+        char* allocate(size_t size)
+        {
+            bytes_used_ += size;
+
+            if (size > chunk_size_)
+                return large_chunks_.emplace_back(Chunk{std::make_unique_for_overwrite<char[]>(size), size}).data.get();
+
+            return allocate_in_chunks(size);
+        }
+
+        std::string_view store(std::string_view text)
+        {
+            char* dest = allocate(text.size());
+
+            if (!text.empty())
+                std::memcpy(dest, text.data(), text.size());
+
+            return {dest, text.size()};
+        }
+
+        // bulk append - texts that outlive the iteration (lvalues, string_views) are copied into one block;
+        // temporaries (e.g. std::strings returned by views::transform) are stored one by one in a single pass
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, std::string_view>
+        std::vector<std::string_view> store_all(R&& texts)
+        {
+            using Reference = std::ranges::range_reference_t<R>;
+
+            std::vector<std::string_view> views;
+
+            if constexpr (std::ranges::forward_range<R>
+                && (std::is_lvalue_reference_v<Reference> || std::same_as<std::remove_cvref_t<Reference>, std::string_view>))
+            {
+                size_t total_size = 0;
+                size_t count = 0;
+                for (std::string_view text : texts)
+                {
+                    total_size += text.size();
+                    ++count;
+                }
+
+                views.reserve(count);
+                char* dest = allocate(total_size);
+
+                for (std::string_view text : texts)
+                {
+                    if (!text.empty())
+                        std::memcpy(dest, text.data(), text.size());
+                    views.emplace_back(dest, text.size());
+                    dest += text.size();
+                }
+            }
+            else
+            {
+                for (auto&& item : texts) // keeps a temporary alive while it is copied
+                    views.push_back(store(std::string_view(item)));
+            }
+
+            return views;
+        }
+
+        // invalidates all views handed out by the arena
+        void reset() noexcept
+        {
+            large_chunks_.clear();
+            if (chunks_.size() > 1)
+                chunks_.erase(chunks_.begin() + 1, chunks_.end());
+            used_ = 0;
+            bytes_used_ = 0;
+        }
+
+        size_t bytes_used() const noexcept
+        {
+            return bytes_used_;
+        }
+
+        size_t bytes_allocated() const noexcept
+        {
+            size_t total = 0;
+            for (const auto& chunk : chunks_)
+                total += chunk.size;
+            for (const auto& chunk : large_chunks_)
+                total += chunk.size;
+            return total;
+        }
+    };
+} // namespace ModernCpp
+
+#endif
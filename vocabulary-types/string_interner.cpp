@@ -0,0 +1,131 @@
+#include "string_interner.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("string_interner")
+{
+    ModernCpp::string_interner tokens;
+
+    SECTION("equal strings get equal dense ids")
+    {
+        auto ala = tokens.intern("ala");
+        auto ma = tokens.intern("ma");
+        auto kota = tokens.intern("kota"s);
+
+        REQUIRE(ala == 0);
+        REQUIRE(ma == 1);
+        REQUIRE(kota == 2);
+        REQUIRE(tokens.intern("ma"sv) == ma);
+        REQUIRE(tokens.size() == 3);
+    }
+
+    SECTION("interned views outlive the source strings")
+    {
+        std::string_view token;
+        {
+            std::string temp = "temporary text";
+            token = tokens.view(tokens.intern(temp));
+        }
+
+        REQUIRE(token == "temporary text");
+    }
+
+    SECTION("find does not insert")
+    {
+        tokens.intern("one");
+
+        REQUIRE(tokens.find("one") == 0u);
+        REQUIRE_FALSE(tokens.find("two").has_value());
+        REQUIRE(tokens.size() == 1);
+    }
+
+    SECTION("empty string")
+    {
+        auto id = tokens.intern("");
+
+        REQUIRE(tokens.view(id).empty());
+        REQUIRE(tokens.intern(""sv) == id);
+    }
+
+    SECTION("many strings - pages and hash table grow")
+    {
+        for (int i = 0; i < 100'000; ++i)
+            REQUIRE(tokens.intern(std::to_string(i)) == static_cast<ModernCpp::string_interner::id_type>(i));
+
+        for (int i = 0; i < 100'000; i += 997)
+        {
+            REQUIRE(tokens.find(std::to_string(i)) == static_cast<ModernCpp::string_interner::id_type>(i));
+            REQUIRE(tokens[static_cast<ModernCpp::string_interner::id_type>(i)] == std::to_string(i));
+        }
+    }
+
+    SECTION("long strings")
+    {
+        const std::string long_text(200'000, 'x');
+
+        auto id = tokens.intern(long_text);
+
+        REQUIRE(tokens.view(id) == long_text);
+        REQUIRE(tokens.intern("short") == id + 1);
+    }
+}
+
+TEST_CASE("string_interner - sorting tokens as integers")
+{
+    std::vector<std::string> words = {"ala", "ma", "kota", "!", "ma", "ala"};
+
+    ModernCpp::string_interner tokens;
+    std::vector<ModernCpp::string_interner::id_type> ids;
+    for (const auto& word : words)
+        ids.push_back(tokens.intern(word));
+
+    const auto ranks = tokens.lexicographic_ranks();
+    std::ranges::sort(ids, {}, [&](auto id) { return ranks[id]; });
+
+    std::vector<std::string_view> sorted_words;
+    for (auto id : ids)
+        sorted_words.push_back(tokens.view(id));
+
+    REQUIRE(sorted_words == std::vector{"!"sv, "ala"sv, "ala"sv, "kota"sv, "ma"sv, "ma"sv});
+}
+
+TEST_CASE("string_interner - concurrent interning")
+{
+    ModernCpp::string_interner tokens;
+    constexpr int thread_count = 4;
+    constexpr int words_count = 20'000;
+
+    std::vector<std::vector<ModernCpp::string_interner::id_type>> results(thread_count);
+
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < words_count; ++i)
+                {
+                    const int word = (i * (t + 1)) % words_count;
+                    results[t].push_back(tokens.intern("word" + std::to_string(word)));
+                }
+            });
+        }
+    }
+
+    REQUIRE(tokens.size() == words_count);
+
+    for (int t = 0; t < thread_count; ++t)
+    {
+        for (int i = 0; i < words_count; ++i)
+        {
+            const int word = (i * (t + 1)) % words_count;
+            REQUIRE(tokens.view(results[t][i]) == "word" + std::to_string(word));
+        }
+    }
+}
@@ -0,0 +1,207 @@
+#ifndef STRING_INTERNER_HPP
+#define STRING_INTERNER_HPP
+
+#include "string_arena.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // string_interner - maps distinct strings to dense 32-bit ids (0, 1, 2, ...)
+    //
+    // Characters of interned strings are copied once into a string_arena owned by the interner,
+    // so the string_views it hands out stay valid for its lifetime.
+    // Reads (find & view) are lock-free; intern() takes a mutex only for new strings.
+    // Comparing & hashing ids is integer work; lexicographic_ranks() makes sorting by content integer work too.
+    class string_interner
+    {
+    public:
+        using id_type = std::uint32_t;
+
+        static constexpr size_t page_size = 4096;  // string_views per page
+        static constexpr size_t max_pages = 4096;  // directory of pages is never reallocated
+        static constexpr size_t max_size = page_size * max_pages;
+
+    private:
+        // slot: high 32 bits - hash of the string, low 32 bits - id + 1 (0 means an empty slot)
+        struct HashTable
+        {
+            size_t mask;
+            std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+
+            explicit HashTable(size_t capacity)
+                : mask{capacity - 1}
+                , slots{new std::atomic<std::uint64_t>[capacity]}
+            {
+                for (size_t i = 0; i < capacity; ++i)
+                    slots[i].store(0, std::memory_order_relaxed);
+            }
+
+            size_t capacity() const noexcept
+            {
+                return mask + 1;
+            }
+        };
+
+        std::unique_ptr<std::atomic<std::string_view*>[]> pages_{new std::atomic<std::string_view*>[max_pages]{}};
+        std::atomic<std::uint32_t> size_{0};
+        std::atomic<HashTable*> table_;
+
+        // owned by writers - guarded by mutex_
+        std::mutex mutex_;
+        std::vector<std::unique_ptr<std::string_view[]>> page_storage_;
+        std::vector<std::unique_ptr<HashTable>> tables_; // old tables are kept alive for concurrent readers
+        string_arena arena_;
+
+        static std::uint64_t hash(std::string_view str) noexcept
+        {
+            return std::hash<std::string_view>{}(str);
+        }
+
+        static std::uint32_t hash_tag(std::uint64_t h) noexcept
+        {
+            return static_cast<std::uint32_t>(h >> 32) ^ static_cast<std::uint32_t>(h);
+        }
+
+        std::optional<id_type> find_in(const HashTable& table, std::string_view str, std::uint64_t h) const noexcept
+        {
+            const std::uint32_t tag = hash_tag(h);
+
+            for (size_t i = h & table.mask;; i = (i + 1) & table.mask)
+            {
+                const std::uint64_t slot = table.slots[i].load(std::memory_order_acquire);
+
+                if (slot == 0)
+                    return std::nullopt;
+
+                if (static_cast<std::uint32_t>(slot >> 32) == tag)
+                {
+                    const id_type id = static_cast<id_type>(slot) - 1;
+                    if (view(id) == str)
+                        return id;
+                }
+            }
+        }
+
+        static void insert_into(HashTable& table, id_type id, std::uint64_t h) noexcept
+        {
+            size_t i = h & table.mask;
+            while (table.slots[i].load(std::memory_order_relaxed) != 0)
+                i = (i + 1) & table.mask;
+
+            table.slots[i].store((std::uint64_t{hash_tag(h)} << 32) | (std::uint64_t{id} + 1), std::memory_order_release);
+        }
+
+        void grow_table()
+        {
+            HashTable* old_table = table_.load(std::memory_order_relaxed);
+            auto new_table = std::make_unique<HashTable>(old_table->capacity() * 2);
+
+            const id_type count = size_.load(std::memory_order_relaxed);
+            for (id_type id = 0; id < count; ++id)
+                insert_into(*new_table, id, hash(view(id)));
+
+            table_.store(new_table.get(), std::memory_order_release);
+            tables_.push_back(std::move(new_table));
+        }
+
+    public:
+        string_interner()
+        {
+            tables_.push_back(std::make_unique<HashTable>(1024));
+            table_.store(tables_.back().get(), std::memory_order_relaxed);
+        }
+
+        string_interner(const string_interner&) = delete;
+        string_interner& operator=(const string_interner&) = delete;
+
+        // returns the id of str - a new id is assigned if str was not interned yet; thread-safe
+        id_type intern(std::string_view str)
+        {
+            const std::uint64_t h = hash(str);
+
+            if (auto id = find_in(*table_.load(std::memory_order_acquire), str, h))
+                return *id;
+
+            std::lock_guard lk{mutex_};
+
+            if (auto id = find_in(*table_.load(std::memory_order_relaxed), str, h)) // inserted by another thread meanwhile
+                return *id;
+
+            const id_type id = size_.load(std::memory_order_relaxed);
+            if (id == max_size)
+                throw std::length_error("string_interner - too many strings");
+
+            const size_t page_index = id / page_size;
+            if (id % page_size == 0)
+            {
+                page_storage_.push_back(std::make_unique<std::string_view[]>(page_size));
+                pages_[page_index].store(page_storage_.back().get(), std::memory_order_release);
+            }
+
+            pages_[page_index].load(std::memory_order_relaxed)[id % page_size] = arena_.store(str);
+            size_.store(id + 1, std::memory_order_release);
+
+            HashTable* table = table_.load(std::memory_order_relaxed);
+            if (2 * (size_t{id} + 1) > table->capacity()) // load factor <= 0.5
+                grow_table();
+            else
+                insert_into(*table, id, h);
+
+            return id;
+        }
+
+        // lock-free
+        std::optional<id_type> find(std::string_view str) const noexcept
+        {
+            return find_in(*table_.load(std::memory_order_acquire), str, hash(str));
+        }
+
+        // lock-free; id must be a value returned by intern() or find()
+        std::string_view view(id_type id) const noexcept
+        {
+            return pages_[id / page_size].load(std::memory_order_acquire)[id % page_size];
+        }
+
+        std::string_view operator[](id_type id) const noexcept
+        {
+            return view(id);
+        }
+
+        size_t size() const noexcept
+        {
+            return size_.load(std::memory_order_acquire);
+        }
+
+        // rank[id] - position of the string in lexicographic order of all interned strings:
+        // view(a) < view(b) <=> rank[a] < rank[b]
+        std::vector<id_type> lexicographic_ranks() const
+        {
+            const auto count = static_cast<id_type>(size());
+
+            std::vector<id_type> ids(count);
+            std::iota(ids.begin(), ids.end(), id_type{0});
+            std::ranges::sort(ids, {}, [this](id_type id) { return view(id); });
+
+            std::vector<id_type> ranks(count);
+            for (id_type position = 0; position < count; ++position)
+                ranks[ids[position]] = position;
+
+            return ranks;
+        }
+    };
+} // namespace ModernCpp
+
+#endif
@@ -0,0 +1,190 @@
+#include "string_sort.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    std::vector<std::string> random_words(size_t count, size_t max_length = 12, int alphabet_size = 26)
+    {
+        std::mt19937 rnd_gen{665};
+        std::uniform_int_distribution<size_t> length_distr{0, max_length};
+        std::uniform_int_distribution<int> char_distr{0, alphabet_size - 1};
+
+        std::vector<std::string> words(count);
+        for (auto& word : words)
+        {
+            word.resize(length_distr(rnd_gen));
+            for (auto& c : word)
+                c = static_cast<char>('a' + char_distr(rnd_gen));
+        }
+
+        return words;
+    }
+
+    struct Token
+    {
+        std::string text;
+        int line;
+    };
+} // namespace
+
+TEST_CASE("radix sort for string_view tokens")
+{
+    std::vector<std::string> words = {"ala", "ma", "kota", "!", "", "kot", "ala", "\xff", "Ala"};
+    std::vector<std::string_view> tokens(words.begin(), words.end());
+
+    SECTION("the same order as std::ranges::sort")
+    {
+        auto expected = tokens;
+        std::ranges::sort(expected);
+
+        ModernCpp::radix_sort(tokens);
+
+        REQUIRE(tokens == expected);
+    }
+
+    SECTION("descending")
+    {
+        auto expected = tokens;
+        std::ranges::sort(expected, std::greater{});
+
+        ModernCpp::radix_sort(tokens, std::greater{});
+
+        REQUIRE(tokens == expected);
+    }
+
+    SECTION("many words with common prefixes")
+    {
+        auto many_words = random_words(50'000, 8, 3);
+        std::vector<std::string_view> many_tokens(many_words.begin(), many_words.end());
+        auto expected = many_tokens;
+        std::ranges::sort(expected);
+
+        ModernCpp::radix_sort(many_tokens);
+
+        REQUIRE(many_tokens == expected);
+    }
+
+    SECTION("long common prefixes & duplicate keys")
+    {
+        const std::string prefix(5000, 'p');
+        std::vector<std::string> long_words(64, prefix);
+        for (size_t i = 0; i < long_words.size(); ++i)
+            long_words[i] += std::to_string(i % 10) + std::string(i % 3, 'x');
+
+        std::vector<std::string_view> long_tokens(long_words.begin(), long_words.end());
+        long_tokens.insert(long_tokens.end(), 40, std::string_view{prefix});
+        auto expected = long_tokens;
+        std::ranges::sort(expected);
+
+        ModernCpp::radix_sort(long_tokens);
+
+        REQUIRE(long_tokens == expected);
+    }
+
+    SECTION("with projection")
+    {
+        std::vector<Token> items = {{"one", 1}, {"two", 2}, {"three", 3}, {"four", 4}};
+
+        ModernCpp::radix_sort(items, std::less{}, &Token::text);
+
+        REQUIRE(std::ranges::is_sorted(items, std::less{}, &Token::text));
+        REQUIRE(items.front().line == 4);
+    }
+
+    SECTION("projection to a std::string member")
+    {
+        std::vector<Token> items = {{"one", 1}, {"two", 2}, {"three", 3}, {"four", 4}};
+
+        auto by_value = [](const Token& t) { return t.text; };
+        static_assert(!ModernCpp::StringSortable<std::vector<Token>&, decltype(by_value)>, "keys would view destroyed temporaries");
+
+        auto by_reference = [](const Token& t) -> const std::string& { return t.text; };
+        ModernCpp::radix_sort(items, std::ranges::less{}, by_reference);
+
+        REQUIRE(std::ranges::is_sorted(items, std::less{}, &Token::text));
+        REQUIRE(items.back().line == 2);
+    }
+
+    SECTION("sorting strings directly")
+    {
+        auto expected = words;
+        std::ranges::sort(expected);
+
+        ModernCpp::radix_sort(words);
+
+        REQUIRE(words == expected);
+    }
+}
+
+TEST_CASE("length sort for string_view tokens")
+{
+    std::vector<std::string> words = {"ala", "ma", "kota", "!", "kot", "ala", "xy"};
+    std::vector<std::string_view> tokens(words.begin(), words.end());
+
+    SECTION("the same order as stable sort with size projection")
+    {
+        auto expected = tokens;
+        std::ranges::stable_sort(expected, std::greater{}, [](const auto& t) { return t.size(); });
+
+        ModernCpp::length_sort(tokens, std::greater{});
+
+        REQUIRE(tokens == expected);
+    }
+
+    SECTION("length + radix")
+    {
+        ModernCpp::length_radix_sort(tokens);
+
+        REQUIRE(tokens == std::vector{"!"sv, "ma"sv, "xy"sv, "ala"sv, "ala"sv, "kot"sv, "kota"sv});
+    }
+
+    SECTION("length + radix descending")
+    {
+        ModernCpp::length_radix_sort(tokens, std::greater{});
+
+        REQUIRE(tokens == std::vector{"kota"sv, "kot"sv, "ala"sv, "ala"sv, "xy"sv, "ma"sv, "!"sv});
+    }
+}
+
+TEST_CASE("radix sort vs std::ranges::sort", "[.benchmark]")
+{
+    const auto words = random_words(1'000'000);
+    const std::vector<std::string_view> tokens(words.begin(), words.end());
+
+    BENCHMARK("std::ranges::sort")
+    {
+        auto data = tokens;
+        std::ranges::sort(data);
+        return data.front();
+    };
+
+    BENCHMARK("ModernCpp::radix_sort")
+    {
+        auto data = tokens;
+        ModernCpp::radix_sort(data);
+        return data.front();
+    };
+
+    BENCHMARK("std::ranges::stable_sort by size")
+    {
+        auto data = tokens;
+        std::ranges::stable_sort(data, std::greater{}, [](const auto& t) { return t.size(); });
+        return data.front();
+    };
+
+    BENCHMARK("ModernCpp::length_sort")
+    {
+        auto data = tokens;
+        ModernCpp::length_sort(data, std::greater{});
+        return data.front();
+    };
+}
@@ -0,0 +1,215 @@
+#ifndef STRING_SORT_HPP
+#define STRING_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // non-comparison sorts for ranges of strings (or items projected to std::string_view)
+    //
+    //   radix_sort(tokens);                          // like std::ranges::sort(tokens)
+    //   radix_sort(tokens, std::greater{});          // like std::ranges::sort(tokens, std::greater{})
+    //   length_sort(tokens, std::greater{});         // like std::ranges::stable_sort(tokens, std::greater{}, &std::string_view::size)
+    //   length_radix_sort(tokens);                   // by size, equal sizes by content
+    //
+    // Only std::less/std::greater (and their std::ranges counterparts) are accepted as comparators.
+    // A projection must return a reference or a std::string_view - not a std::string by value.
+
+    template <typename R, typename Proj>
+    concept StringSortable = std::ranges::random_access_range<R>
+        && std::ranges::sized_range<R>
+        && std::permutable<std::ranges::iterator_t<R>>
+        && std::convertible_to<std::indirect_result_t<Proj&, std::ranges::iterator_t<R>>, std::string_view>
+        // keys are viewed many times during a sort - a projection returning a temporary string would leave dangling views
+        && (std::is_reference_v<std::indirect_result_t<Proj&, std::ranges::iterator_t<R>>>
+            || std::same_as<std::remove_cvref_t<std::indirect_result_t<Proj&, std::ranges::iterator_t<R>>>, std::string_view>);
+
+    namespace detail
+    {
+        template <typename Comp>
+        constexpr bool is_ascending_v = std::same_as<Comp, std::less<>> || std::same_as<Comp, std::ranges::less>
+            || std::same_as<Comp, std::less<std::string_view>>;
+
+        template <typename Comp>
+        constexpr bool is_descending_v = std::same_as<Comp, std::greater<>> || std::same_as<Comp, std::ranges::greater>
+            || std::same_as<Comp, std::greater<std::string_view>>;
+
+        template <typename Comp>
+        concept SortDirection = is_ascending_v<Comp> || is_descending_v<Comp>;
+
+        inline constexpr size_t radix_sort_threshold = 32; // smaller buckets are sorted with std::sort
+
+        template <typename Proj, typename T>
+        std::string_view key_of(Proj& proj, const T& item)
+        {
+            return std::string_view(std::invoke(proj, item));
+        }
+
+        // bucket 0 - string ends before depth, bucket 1 + c - character c at depth
+        inline size_t bucket_of(std::string_view key, size_t depth) noexcept
+        {
+            return depth < key.size() ? 1 + static_cast<unsigned char>(key[depth]) : 0;
+        }
+
+        template <typename It>
+        struct radix_sort_task
+        {
+            It first;
+            It last;
+            size_t depth; // all items in [first, last) share the same prefix of length depth
+        };
+
+        // buckets waiting for the next pass are kept on an explicit stack - the depth of a recursive
+        // version would grow with the length of common prefixes
+        template <typename It, typename T, typename Proj>
+        void msd_radix_sort(It first, It last, T* buffer, size_t depth, Proj& proj)
+        {
+            std::vector<radix_sort_task<It>> tasks{{first, last, depth}};
+
+            while (!tasks.empty())
+            {
+                auto [task_first, task_last, task_depth] = tasks.back();
+                tasks.pop_back();
+
+                const auto size = static_cast<size_t>(task_last - task_first);
+
+                if (size < radix_sort_threshold)
+                {
+                    std::sort(task_first, task_last, [&, d = task_depth](const auto& a, const auto& b) {
+                        return key_of(proj, a).substr(d) < key_of(proj, b).substr(d);
+                    });
+                    continue;
+                }
+
+                std::array<size_t, 257> offsets{};
+                for (auto it = task_first; it != task_last; ++it)
+                    ++offsets[bucket_of(key_of(proj, *it), task_depth)];
+
+                // every key has the same character at depth - no need to move anything
+                if (const auto full = std::ranges::find(offsets, size); full != offsets.end())
+                {
+                    if (full != offsets.begin()) // bucket 0 holds equal strings - nothing to do
+                        tasks.push_back({task_first, task_last, task_depth + 1});
+                    continue;
+                }
+
+                const std::array<size_t, 257> counts = offsets;
+                size_t sum = 0;
+                for (auto& offset : offsets)
+                    sum += std::exchange(offset, sum);
+
+                for (auto it = task_first; it != task_last; ++it)
+                    buffer[offsets[bucket_of(key_of(proj, *it), task_depth)]++] = std::ranges::iter_move(it);
+
+                std::move(buffer, buffer + size, task_first);
+
+                // bucket 0 holds equal strings - nothing to do
+                auto bucket_first = task_first + static_cast<std::iter_difference_t<It>>(counts[0]);
+                for (size_t bucket = 1; bucket < counts.size(); ++bucket)
+                {
+                    auto bucket_last = bucket_first + static_cast<std::iter_difference_t<It>>(counts[bucket]);
+                    if (counts[bucket] > 1)
+                        tasks.push_back({bucket_first, bucket_last, task_depth + 1});
+                    bucket_first = bucket_last;
+                }
+            }
+        }
+
+        // stable counting sort by key size
+        template <typename It, typename T, typename Proj>
+        void length_counting_sort(It first, It last, T* buffer, bool descending, Proj& proj)
+        {
+            size_t max_length = 0;
+            for (auto it = first; it != last; ++it)
+                max_length = std::max(max_length, key_of(proj, *it).size());
+
+            std::vector<size_t> offsets(max_length + 1);
+            for (auto it = first; it != last; ++it)
+            {
+                const size_t length = key_of(proj, *it).size();
+                ++offsets[descending ? max_length - length : length];
+            }
+
+            size_t sum = 0;
+            for (auto& offset : offsets)
+                sum += std::exchange(offset, sum);
+
+            for (auto it = first; it != last; ++it)
+            {
+                const size_t length = key_of(proj, *it).size();
+                buffer[offsets[descending ? max_length - length : length]++] = std::ranges::iter_move(it);
+            }
+
+            std::move(buffer, buffer + (last - first), first);
+        }
+    } // namespace detail
+
+    // MSD radix sort - lexicographic order of std::string_view (the same as operator<)
+    template <typename R, detail::SortDirection Comp = std::ranges::less, typename Proj = std::identity>
+        requires StringSortable<R, Proj>
+    std::ranges::borrowed_iterator_t<R> radix_sort(R&& rng, Comp = {}, Proj proj = {})
+    {
+        auto first = std::ranges::begin(rng);
+        auto last = std::ranges::end(rng);
+
+        std::vector<std::ranges::range_value_t<R>> buffer(std::ranges::size(rng));
+        detail::msd_radix_sort(first, first + std::ranges::distance(rng), buffer.data(), 0, proj);
+
+        if constexpr (detail::is_descending_v<Comp>)
+            std::ranges::reverse(rng);
+
+        return last;
+    }
+
+    // stable sort by size of the projected string
+    template <typename R, detail::SortDirection Comp = std::ranges::less, typename Proj = std::identity>
+        requires StringSortable<R, Proj>
+    std::ranges::borrowed_iterator_t<R> length_sort(R&& rng, Comp = {}, Proj proj = {})
+    {
+        auto first = std::ranges::begin(rng);
+        auto last = std::ranges::end(rng);
+
+        std::vector<std::ranges::range_value_t<R>> buffer(std::ranges::size(rng));
+        detail::length_counting_sort(first, first + std::ranges::distance(rng), buffer.data(), detail::is_descending_v<Comp>, proj);
+
+        return last;
+    }
+
+    // shortlex order - by size, strings of equal size by content (both in Comp direction)
+    template <typename R, detail::SortDirection Comp = std::ranges::less, typename Proj = std::identity>
+        requires StringSortable<R, Proj>
+    std::ranges::borrowed_iterator_t<R> length_radix_sort(R&& rng, Comp = {}, Proj proj = {})
+    {
+        length_sort(rng, std::ranges::less{}, proj);
+
+        auto bucket_first = std::ranges::begin(rng);
+        const auto last = bucket_first + std::ranges::distance(rng);
+
+        while (bucket_first != last)
+        {
+            const size_t length = detail::key_of(proj, *bucket_first).size();
+            auto bucket_last = std::find_if(bucket_first, last, [&](const auto& item) { return detail::key_of(proj, item).size() != length; });
+
+            radix_sort(std::ranges::subrange(bucket_first, bucket_last), std::ranges::less{}, proj);
+            bucket_first = bucket_last;
+        }
+
+        if constexpr (detail::is_descending_v<Comp>)
+            std::ranges::reverse(rng);
+
+        return std::ranges::end(rng);
+    }
+} // namespace ModernCpp
+
+#endif
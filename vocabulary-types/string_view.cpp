@@ -1,3 +1,5 @@
+#include "zstring.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <string>
@@ -57,8 +59,7 @@ namespace ModernCpp
         std::cout << text << "\n";
 
         //fopen(text.c_str(), "rw+");  // BEWARE!!!
-        std::string filename(text);
-        fopen(filename.c_str(), "rw+");
+        auto file = open_file(text, "rw+"); // NUL-terminated copy on the stack - no std::string allocation
     }
 }
 
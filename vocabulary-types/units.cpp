@@ -0,0 +1,131 @@
+#include "units.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numeric>
+#include <ratio>
+#include <vector>
+
+using namespace ModernCpp::units;
+using namespace ModernCpp::units::literals;
+
+namespace
+{
+    bool close_to(double a, double b)
+    {
+        return std::abs(a - b) < 1e-9;
+    }
+
+    template <typename A, typename B>
+    concept Addable = requires(A a, B b) { a + b; };
+
+    template <typename From, typename To>
+    concept ImplicitlyConvertible = std::is_convertible_v<From, To>;
+} // namespace
+
+TEST_CASE("units - compile time checks")
+{
+    static_assert(sizeof(meters) == sizeof(double));
+    static_assert(std::is_trivially_copyable_v<centimeters>);
+
+    static_assert((1.5_m + 20_cm).count() == 170.0);
+    static_assert(std::is_same_v<decltype(1.5_m + 20_cm), centimeters>);
+    static_assert(meters{250_cm}.count() == 2.5);
+    static_assert(1_km == 1000_m);
+    static_assert(10_mm < 2_cm);
+
+    static_assert(Addable<meters, centimeters>);
+    static_assert(!Addable<meters, seconds>);
+    static_assert(!ImplicitlyConvertible<seconds, meters>);
+    static_assert(!ImplicitlyConvertible<double, meters>); // no implicit unit for raw numbers
+
+    // integral reps - only exact conversions are implicit
+    using int_meters = quantity<length, std::ratio<1>, int>;
+    using int_centimeters = quantity<length, std::centi, int>;
+    static_assert(ImplicitlyConvertible<int_meters, int_centimeters>);
+    static_assert(!ImplicitlyConvertible<int_centimeters, int_meters>);
+    static_assert(quantity_cast<int_meters>(int_centimeters{250}).count() == 2);
+}
+
+TEST_CASE("units - arithmetic")
+{
+    SECTION("mixed units of length")
+    {
+        meters distance = 1_km + 250_m + 50_cm;
+        REQUIRE(distance.count() == 1250.5);
+    }
+
+    SECTION("area")
+    {
+        auto a = 2_m * 50_cm;
+        static_assert(std::is_same_v<decltype(a)::dimension_type, area>);
+
+        square_meters sq_m = a;
+        REQUIRE(close_to(sq_m.count(), 1.0));
+    }
+
+    SECTION("velocity")
+    {
+        kilometers_per_hour v = 100_m / 10_s;
+        REQUIRE(close_to(v.count(), 36.0));
+
+        meters_per_second v_mps = 72_km / 1_h;
+        REQUIRE(close_to(v_mps.count(), 20.0));
+
+        meters d = v_mps * 3_s;
+        REQUIRE(close_to(d.count(), 60.0));
+    }
+
+    SECTION("scaling")
+    {
+        auto l = 3 * 20_cm / 2.0;
+        REQUIRE(l == 30_cm);
+
+        l += 5_cm;
+        l *= 2;
+        REQUIRE(l == 70_cm);
+    }
+}
+
+TEST_CASE("units - bulk conversion")
+{
+    std::vector<centimeters> lengths_cm;
+    for (int i = 0; i < 1000; ++i)
+        lengths_cm.push_back(centimeters{static_cast<double>(i)});
+
+    std::vector<meters> lengths_m(lengths_cm.size());
+    convert(lengths_cm, lengths_m);
+
+    REQUIRE(std::ranges::all_of(std::views::iota(0, 1000), [&](int i) { return close_to(lengths_m[i].count(), i / 100.0); }));
+
+    std::vector<meters> too_small(10);
+    REQUIRE_THROWS_AS(convert(lengths_cm, too_small), std::length_error);
+}
+
+TEST_CASE("units - bulk conversion vs raw doubles", "[.benchmark]")
+{
+    constexpr size_t size = 100'000;
+
+    std::vector<double> raw_cm(size);
+    std::iota(raw_cm.begin(), raw_cm.end(), 0.0);
+    std::vector<double> raw_m(size);
+
+    std::vector<centimeters> cm(size);
+    std::ranges::transform(raw_cm, cm.begin(), [](double v) { return centimeters{v}; });
+    std::vector<meters> m(size);
+
+    BENCHMARK("raw doubles")
+    {
+        for (size_t i = 0; i < size; ++i)
+            raw_m[i] = raw_cm[i] * 0.01;
+        return raw_m.back();
+    };
+
+    BENCHMARK("convert(centimeters -> meters)")
+    {
+        convert(cm, m);
+        return m.back();
+    };
+}
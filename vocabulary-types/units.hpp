@@ -0,0 +1,336 @@
+#ifndef UNITS_HPP
+#define UNITS_HPP
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ModernCpp::units
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // quantity<Dimension, Ratio, Rep> - value with a unit checked at compile time
+    //
+    //   auto d = 1.5_m + 20.0_cm;        // quantity<length, std::centi> - 170 cm
+    //   meters m = d;                     // 1.7 m - scale factor is a compile-time constant
+    //   auto v = d / 2.0_s;               // quantity<velocity, ...>
+    //   auto x = d + 2.0_s;               // ERROR - different dimensions
+    //
+    // The unit lives only in the type: sizeof(quantity) == sizeof(Rep) and the arithmetic
+    // compiles to the same instructions as raw Rep math (scaling by 1 folds away).
+
+    template <int Length, int Mass, int Time>
+    struct dimension
+    {
+        static constexpr int length = Length;
+        static constexpr int mass = Mass;
+        static constexpr int time = Time;
+    };
+
+    using dimensionless = dimension<0, 0, 0>;
+    using length = dimension<1, 0, 0>;
+    using area = dimension<2, 0, 0>;
+    using volume = dimension<3, 0, 0>;
+    using mass = dimension<0, 1, 0>;
+    using duration = dimension<0, 0, 1>;
+    using velocity = dimension<1, 0, -1>;
+    using acceleration = dimension<1, 0, -2>;
+
+    namespace detail
+    {
+        template <typename D1, typename D2>
+        using dimension_product = dimension<D1::length + D2::length, D1::mass + D2::mass, D1::time + D2::time>;
+
+        template <typename D1, typename D2>
+        using dimension_quotient = dimension<D1::length - D2::length, D1::mass - D2::mass, D1::time - D2::time>;
+
+        // the largest ratio both R1 & R2 are integral multiples of (like std::chrono::duration)
+        template <typename R1, typename R2>
+        using common_ratio = std::ratio<std::gcd(R1::num, R2::num), std::lcm(R1::den, R2::den)>;
+
+        template <typename From, typename To, typename Rep>
+        constexpr Rep conversion_factor = static_cast<Rep>(std::ratio_divide<From, To>::num) / static_cast<Rep>(std::ratio_divide<From, To>::den);
+
+        template <typename From, typename To, typename Rep>
+        constexpr Rep convert_value(Rep value)
+        {
+            using R = std::ratio_divide<From, To>;
+
+            if constexpr (R::num == 1 && R::den == 1)
+                return value;
+            else if constexpr (R::den == 1)
+                return value * static_cast<Rep>(R::num);
+            else if constexpr (std::floating_point<Rep>)
+                return value * conversion_factor<From, To, Rep>;
+            else
+                return value * static_cast<Rep>(R::num) / static_cast<Rep>(R::den);
+        }
+    } // namespace detail
+
+    template <typename Dim, typename Ratio = std::ratio<1>, typename Rep = double>
+    class quantity
+    {
+        Rep value_{};
+
+    public:
+        using dimension_type = Dim;
+        using ratio = typename Ratio::type;
+        using rep = Rep;
+
+        constexpr quantity() = default;
+
+        constexpr explicit quantity(Rep value) noexcept
+            : value_{value}
+        { }
+
+        // implicit conversion between units of the same dimension - lossy conversions only for floating-point reps
+        template <typename OtherRatio>
+            requires std::floating_point<Rep> || (std::ratio_divide<OtherRatio, Ratio>::den == 1)
+        constexpr quantity(const quantity<Dim, OtherRatio, Rep>& other) noexcept
+            : value_{detail::convert_value<OtherRatio, Ratio>(other.count())}
+        { }
+
+        constexpr Rep count() const noexcept
+        {
+            return value_;
+        }
+
+        constexpr quantity operator+() const noexcept
+        {
+            return *this;
+        }
+
+        constexpr quantity operator-() const noexcept
+        {
+            return quantity{-value_};
+        }
+
+        constexpr quantity& operator+=(const quantity& other) noexcept
+        {
+            value_ += other.value_;
+            return *this;
+        }
+
+        constexpr quantity& operator-=(const quantity& other) noexcept
+        {
+            value_ -= other.value_;
+            return *this;
+        }
+
+        constexpr quantity& operator*=(Rep factor) noexcept
+        {
+            value_ *= factor;
+            return *this;
+        }
+
+        constexpr quantity& operator/=(Rep factor) noexcept
+        {
+            value_ /= factor;
+            return *this;
+        }
+    };
+
+    template <typename T>
+    struct is_quantity : std::false_type
+    { };
+
+    template <typename Dim, typename Ratio, typename Rep>
+    struct is_quantity<quantity<Dim, Ratio, Rep>> : std::true_type
+    { };
+
+    template <typename T>
+    concept Quantity = is_quantity<std::remove_cvref_t<T>>::value;
+
+    template <Quantity ToQuantity, typename Dim, typename Ratio, typename Rep>
+        requires std::same_as<typename ToQuantity::dimension_type, Dim>
+    constexpr ToQuantity quantity_cast(const quantity<Dim, Ratio, Rep>& q) noexcept
+    {
+        using ToRep = typename ToQuantity::rep;
+        return ToQuantity{static_cast<ToRep>(detail::convert_value<Ratio, typename ToQuantity::ratio>(static_cast<std::common_type_t<Rep, ToRep>>(q.count())))};
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // arithmetic - mixed units of the same dimension are computed in their common unit
+
+    template <typename Dim, typename R1, typename R2, typename Rep>
+    constexpr auto operator+(const quantity<Dim, R1, Rep>& a, const quantity<Dim, R2, Rep>& b) noexcept
+    {
+        using Q = quantity<Dim, detail::common_ratio<R1, R2>, Rep>;
+        return Q{Q{a}.count() + Q{b}.count()};
+    }
+
+    template <typename Dim, typename R1, typename R2, typename Rep>
+    constexpr auto operator-(const quantity<Dim, R1, Rep>& a, const quantity<Dim, R2, Rep>& b) noexcept
+    {
+        using Q = quantity<Dim, detail::common_ratio<R1, R2>, Rep>;
+        return Q{Q{a}.count() - Q{b}.count()};
+    }
+
+    template <typename D1, typename R1, typename D2, typename R2, typename Rep>
+    constexpr auto operator*(const quantity<D1, R1, Rep>& a, const quantity<D2, R2, Rep>& b) noexcept
+    {
+        return quantity<detail::dimension_product<D1, D2>, std::ratio_multiply<R1, R2>, Rep>{a.count() * b.count()};
+    }
+
+    template <typename D1, typename R1, typename D2, typename R2, typename Rep>
+    constexpr auto operator/(const quantity<D1, R1, Rep>& a, const quantity<D2, R2, Rep>& b) noexcept
+    {
+        return quantity<detail::dimension_quotient<D1, D2>, std::ratio_divide<R1, R2>, Rep>{a.count() / b.count()};
+    }
+
+    template <typename Dim, typename Ratio, typename Rep>
+    constexpr quantity<Dim, Ratio, Rep> operator*(const quantity<Dim, Ratio, Rep>& q, std::type_identity_t<Rep> factor) noexcept
+    {
+        return quantity<Dim, Ratio, Rep>{q.count() * factor};
+    }
+
+    template <typename Dim, typename Ratio, typename Rep>
+    constexpr quantity<Dim, Ratio, Rep> operator*(std::type_identity_t<Rep> factor, const quantity<Dim, Ratio, Rep>& q) noexcept
+    {
+        return quantity<Dim, Ratio, Rep>{factor * q.count()};
+    }
+
+    template <typename Dim, typename Ratio, typename Rep>
+    constexpr quantity<Dim, Ratio, Rep> operator/(const quantity<Dim, Ratio, Rep>& q, std::type_identity_t<Rep> factor) noexcept
+    {
+        return quantity<Dim, Ratio, Rep>{q.count() / factor};
+    }
+
+    template <typename Dim, typename R1, typename R2, typename Rep>
+    constexpr bool operator==(const quantity<Dim, R1, Rep>& a, const quantity<Dim, R2, Rep>& b) noexcept
+    {
+        using Q = quantity<Dim, detail::common_ratio<R1, R2>, Rep>;
+        return Q{a}.count() == Q{b}.count();
+    }
+
+    template <typename Dim, typename R1, typename R2, typename Rep>
+    constexpr auto operator<=>(const quantity<Dim, R1, Rep>& a, const quantity<Dim, R2, Rep>& b) noexcept
+    {
+        using Q = quantity<Dim, detail::common_ratio<R1, R2>, Rep>;
+        return Q{a}.count() <=> Q{b}.count();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // units
+
+    using kilometers = quantity<length, std::kilo>;
+    using meters = quantity<length>;
+    using centimeters = quantity<length, std::centi>;
+    using millimeters = quantity<length, std::milli>;
+
+    using square_meters = quantity<area>;
+
+    using kilograms = quantity<mass>;
+    using grams = quantity<mass, std::milli>;
+
+    using hours = quantity<duration, std::ratio<3600>>;
+    using seconds = quantity<duration>;
+    using milliseconds = quantity<duration, std::milli>;
+
+    using meters_per_second = quantity<velocity>;
+    using kilometers_per_hour = quantity<velocity, std::ratio_divide<std::kilo, std::ratio<3600>>>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // bulk conversion - out[i] = in[i] converted to the unit of out
+    //
+    // Both ranges are contiguous arrays of Rep with the scale factor known at compile time,
+    // so the loop is a single vectorizable multiplication.
+    template <std::ranges::contiguous_range In, std::ranges::contiguous_range Out>
+        requires Quantity<std::ranges::range_value_t<In>> && Quantity<std::ranges::range_value_t<Out>>
+        && std::same_as<typename std::ranges::range_value_t<In>::dimension_type, typename std::ranges::range_value_t<Out>::dimension_type>
+        && std::same_as<typename std::ranges::range_value_t<In>::rep, typename std::ranges::range_value_t<Out>::rep>
+    void convert(In&& in, Out&& out)
+    {
+        using FromQuantity = std::ranges::range_value_t<In>;
+        using ToQuantity = std::ranges::range_value_t<Out>;
+
+        const auto size = static_cast<size_t>(std::ranges::size(in));
+        if (static_cast<size_t>(std::ranges::size(out)) < size)
+            throw std::length_error("convert - output range is too small");
+
+        const FromQuantity* src = std::ranges::data(in);
+        ToQuantity* dest = std::ranges::data(out);
+
+        for (size_t i = 0; i < size; ++i)
+            dest[i] = quantity_cast<ToQuantity>(src[i]);
+    }
+
+    namespace literals
+    {
+        constexpr kilometers operator""_km(long double value)
+        {
+            return kilometers{static_cast<double>(value)};
+        }
+
+        constexpr kilometers operator""_km(unsigned long long value)
+        {
+            return kilometers{static_cast<double>(value)};
+        }
+
+        constexpr meters operator""_m(long double value)
+        {
+            return meters{static_cast<double>(value)};
+        }
+
+        constexpr meters operator""_m(unsigned long long value)
+        {
+            return meters{static_cast<double>(value)};
+        }
+
+        constexpr centimeters operator""_cm(long double value)
+        {
+            return centimeters{static_cast<double>(value)};
+        }
+
+        constexpr centimeters operator""_cm(unsigned long long value)
+        {
+            return centimeters{static_cast<double>(value)};
+        }
+
+        constexpr millimeters operator""_mm(long double value)
+        {
+            return millimeters{static_cast<double>(value)};
+        }
+
+        constexpr millimeters operator""_mm(unsigned long long value)
+        {
+            return millimeters{static_cast<double>(value)};
+        }
+
+        constexpr seconds operator""_s(long double value)
+        {
+            return seconds{static_cast<double>(value)};
+        }
+
+        constexpr seconds operator""_s(unsigned long long value)
+        {
+            return seconds{static_cast<double>(value)};
+        }
+
+        constexpr hours operator""_h(long double value)
+        {
+            return hours{static_cast<double>(value)};
+        }
+
+        constexpr hours operator""_h(unsigned long long value)
+        {
+            return hours{static_cast<double>(value)};
+        }
+
+        constexpr kilograms operator""_kg(long double value)
+        {
+            return kilograms{static_cast<double>(value)};
+        }
+
+        constexpr kilograms operator""_kg(unsigned long long value)
+        {
+            return kilograms{static_cast<double>(value)};
+        }
+    } // namespace literals
+} // namespace ModernCpp::units
+
+#endif
@@ -0,0 +1,254 @@
+#include "zstring.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <string>
+#include <string_view>
+
+using namespace std::literals;
+
+////////////////////////////////////////////////////////////////////////////////
+// allocation counting
+//
+// Global operator new/delete are replaced for the whole test executable, so the complete set
+// of overloads (array, nothrow, aligned) is replaced - all of them allocate with malloc &
+// free with free. Allocations are counted only on the thread running allocations_during().
+
+namespace
+{
+    thread_local bool counting_allocations = false;
+    thread_local size_t allocation_count = 0;
+
+    size_t allocations_during(auto&& f)
+    {
+        allocation_count = 0;
+        counting_allocations = true;
+        f();
+        counting_allocations = false;
+        return allocation_count;
+    }
+
+    void* counted_malloc(size_t size, size_t alignment = 0) noexcept
+    {
+        if (counting_allocations)
+            ++allocation_count;
+
+        if (size == 0)
+            size = 1;
+
+        if (alignment > alignof(std::max_align_t))
+            return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+
+        return std::malloc(size);
+    }
+
+    void* counted_new(size_t size, size_t alignment = 0)
+    {
+        if (void* ptr = counted_malloc(size, alignment))
+            return ptr;
+        throw std::bad_alloc{};
+    }
+} // namespace
+
+void* operator new(size_t size)
+{
+    return counted_new(size);
+}
+
+void* operator new[](size_t size)
+{
+    return counted_new(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return counted_new(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return counted_new(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+TEST_CASE("zstring_view")
+{
+    SECTION("from literal")
+    {
+        ModernCpp::zstring_view zsv = "text.txt";
+        REQUIRE(zsv.size() == 8);
+        REQUIRE(zsv.c_str()[zsv.size()] == '\0');
+        REQUIRE(zsv == "text.txt"sv);
+    }
+
+    SECTION("from std::string - no copy")
+    {
+        std::string str = "data.bin";
+        ModernCpp::zstring_view zsv = str;
+        REQUIRE(zsv.c_str() == str.c_str());
+    }
+
+    SECTION("default is empty string")
+    {
+        ModernCpp::zstring_view zsv;
+        REQUIRE(zsv.empty());
+        REQUIRE(zsv.c_str()[0] == '\0');
+    }
+}
+
+TEST_CASE("small_cstring")
+{
+    const std::string text = "/tmp/some/rather/long/path/to/a/file.txt";
+    std::string_view path = text;
+    path.remove_suffix(4); // not NUL-terminated anymore
+
+    SECTION("short text is terminated in an inline buffer")
+    {
+        size_t allocations = allocations_during([&] {
+            ModernCpp::small_cstring<64> cstr{path};
+            REQUIRE(cstr.is_inline());
+            REQUIRE(cstr.c_str() == "/tmp/some/rather/long/path/to/a/file"sv);
+        });
+
+        REQUIRE(allocations == 0);
+    }
+
+    SECTION("long text falls back to heap")
+    {
+        size_t allocations = allocations_during([&] {
+            ModernCpp::small_cstring<16> cstr{path};
+            REQUIRE_FALSE(cstr.is_inline());
+            REQUIRE(cstr.c_str() == "/tmp/some/rather/long/path/to/a/file"sv);
+        });
+
+        REQUIRE(allocations == 1);
+    }
+
+    SECTION("boundary")
+    {
+        ModernCpp::small_cstring<5> fits{"abcd"sv};
+        REQUIRE(fits.is_inline());
+
+        ModernCpp::small_cstring<5> too_long{"abcde"sv};
+        REQUIRE_FALSE(too_long.is_inline());
+        REQUIRE(too_long.c_str() == "abcde"sv);
+    }
+}
+
+TEST_CASE("open_file")
+{
+    const std::string filename = (std::filesystem::temp_directory_path() / "zstring_open_file_test.txt").string();
+    const std::string line = filename + "|trailing text";
+    const std::string_view path = std::string_view{line}.substr(0, filename.size()); // not NUL-terminated
+
+    SECTION("string_view path - no heap allocation for the path")
+    {
+        ModernCpp::file_ptr file;
+
+        size_t allocations = allocations_during([&] {
+            file = ModernCpp::open_file(path, "w");
+        });
+
+        REQUIRE(file != nullptr);
+        // glibc's fopen allocates the FILE object itself with malloc - not counted by operator new
+        REQUIRE(allocations == 0);
+
+        std::fputs("content", file.get());
+        file.reset();
+
+        auto in = ModernCpp::open_file(filename, "r");
+        REQUIRE(in != nullptr);
+        char buffer[16]{};
+        REQUIRE(std::fgets(buffer, sizeof(buffer), in.get()) == "content"sv);
+    }
+
+    SECTION("missing file")
+    {
+        auto file = ModernCpp::open_file("/non-existing-dir/file.txt", "r");
+        REQUIRE(file == nullptr);
+    }
+
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,163 @@
+#ifndef ZSTRING_HPP
+#define ZSTRING_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace ModernCpp
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    // zstring_view - std::string_view that is known to be NUL-terminated
+    //
+    // Can be built only from sources that guarantee the terminator (literals, const char*, std::string),
+    // so c_str() can be passed to C APIs without a copy.
+    class zstring_view
+    {
+        std::string_view text_;
+
+        zstring_view(const char* text, size_t size) noexcept
+            : text_{text, size}
+        { }
+
+        template <size_t N>
+        friend class small_cstring;
+
+    public:
+        constexpr zstring_view() noexcept
+            : text_{""}
+        { }
+
+        constexpr zstring_view(const char* text) noexcept
+            : text_{text}
+        { }
+
+        zstring_view(const std::string& text) noexcept
+            : text_{text}
+        { }
+
+        zstring_view(std::string&&) = delete; // would dangle
+
+        const char* c_str() const noexcept
+        {
+            return text_.data();
+        }
+
+        std::string_view view() const noexcept
+        {
+            return text_;
+        }
+
+        operator std::string_view() const noexcept
+        {
+            return text_;
+        }
+
+        size_t size() const noexcept
+        {
+            return text_.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return text_.empty();
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // small_cstring<N> - NUL-terminated copy of a std::string_view
+    //
+    // Texts shorter than N are copied into an inline buffer (no heap allocation),
+    // longer texts fall back to a heap allocation.
+    template <size_t N = 256>
+    class small_cstring
+    {
+        static_assert(N > 0);
+
+        std::array<char, N> buffer_;
+        std::unique_ptr<char[]> heap_buffer_;
+        size_t size_;
+
+    public:
+        static constexpr size_t inline_capacity = N - 1;
+
+        explicit small_cstring(std::string_view text)
+            : size_{text.size()}
+        {
+            char* dest = buffer_.data();
+
+            if (text.size() > inline_capacity)
+            {
+                heap_buffer_ = std::make_unique_for_overwrite<char[]>(text.size() + 1);
+                dest = heap_buffer_.get();
+            }
+
+            if (!text.empty())
+                std::memcpy(dest, text.data(), text.size());
+            dest[text.size()] = '\0';
+        }
+
+        small_cstring(const small_cstring&) = delete;
+        small_cstring& operator=(const small_cstring&) = delete;
+
+        const char* c_str() const noexcept
+        {
+            return heap_buffer_ ? heap_buffer_.get() : buffer_.data();
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool is_inline() const noexcept
+        {
+            return heap_buffer_ == nullptr;
+        }
+
+        operator zstring_view() const noexcept
+        {
+            return zstring_view{c_str(), size_};
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // file-open helpers
+
+    struct FileCloser
+    {
+        void operator()(std::FILE* file) const noexcept
+        {
+            std::fclose(file);
+        }
+    };
+
+    using file_ptr = std::unique_ptr<std::FILE, FileCloser>;
+
+    inline file_ptr open_file(zstring_view path, zstring_view mode)
+    {
+        return file_ptr{std::fopen(path.c_str(), mode.c_str())};
+    }
+
+    // paths shorter than 256 chars are terminated on the stack - no heap allocation
+    inline file_ptr open_file(std::string_view path, zstring_view mode)
+    {
+        return open_file(small_cstring<256>{path}, mode);
+    }
+
+    inline file_ptr open_file(const char* path, zstring_view mode)
+    {
+        return open_file(zstring_view{path}, mode);
+    }
+
+    inline file_ptr open_file(const std::string& path, zstring_view mode)
+    {
+        return open_file(zstring_view{path}, mode);
+    }
+} // namespace ModernCpp
+
+#endif